@@ -0,0 +1,114 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/cmake/colors.cmake"
+  "/root/repo/tests/cmake/macrosForCreatingTests.cmake"
+  "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake"
+  "/root/repo/tests/cmake/options.cmake"
+  "/root/repo/tests/cmake/version.cmake"
+  "/root/repo/tests/logging/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePrintHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/pressio-log-compiled.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/compile-time-benchmark.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_serial.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_formatting.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_write_serial.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_binary.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_active_level.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_allocations.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_async.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_deferred.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_rate_limited.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_callsites.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_channels.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_environment.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_timestamps.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_ranges.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_macros.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_include_order.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/compile_fail_valid_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_bad_spec_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_missing_argument_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_string_format_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_array_format_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_string_format_macros_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_array_format_macros_cxx17.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/compile_fail_valid_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_bad_spec_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_missing_argument_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_string_format_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_array_format_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_string_format_macros_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_array_format_macros_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_compile_fail_missing_argument_macros_cxx20.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_serial_compiled.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_formatting_compiled.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_callsites_compiled.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_macros_compiled.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_mpi_np3.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_comm_change_np3.dir/DependInfo.cmake"
+  "tests/logging/CMakeFiles/test_logger_write_mpi_np3.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pressio-log-compiled.dir/pressio-log.cc.o"
+  "CMakeFiles/pressio-log-compiled.dir/pressio-log.cc.o.d"
+  "libpressio-log-compiled.a"
+  "libpressio-log-compiled.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pressio-log-compiled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_fail_valid_cxx20.dir/compile_fail.cc.o"
+  "CMakeFiles/compile_fail_valid_cxx20.dir/compile_fail.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_fail_valid_cxx20.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
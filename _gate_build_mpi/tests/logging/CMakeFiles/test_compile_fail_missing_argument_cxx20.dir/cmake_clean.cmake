@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_compile_fail_missing_argument_cxx20.dir/compile_fail.cc.o"
+  "CMakeFiles/test_compile_fail_missing_argument_cxx20.dir/compile_fail.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_compile_fail_missing_argument_cxx20.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_active_level.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_active_level.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_active_level.dir/test_logger_active_level.cc.o"
+  "CMakeFiles/test_logger_active_level.dir/test_logger_active_level.cc.o.d"
+  "test_logger_active_level"
+  "test_logger_active_level.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_active_level.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_allocations.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_allocations.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_allocations.dir/test_logger_allocations.cc.o"
+  "CMakeFiles/test_logger_allocations.dir/test_logger_allocations.cc.o.d"
+  "test_logger_allocations"
+  "test_logger_allocations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_allocations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_async.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_async.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_async.dir/test_logger_async.cc.o"
+  "CMakeFiles/test_logger_async.dir/test_logger_async.cc.o.d"
+  "test_logger_async"
+  "test_logger_async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
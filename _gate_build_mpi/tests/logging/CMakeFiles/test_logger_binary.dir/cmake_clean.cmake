@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_binary.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_binary.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_binary.dir/test_logger_binary.cc.o"
+  "CMakeFiles/test_logger_binary.dir/test_logger_binary.cc.o.d"
+  "test_logger_binary"
+  "test_logger_binary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
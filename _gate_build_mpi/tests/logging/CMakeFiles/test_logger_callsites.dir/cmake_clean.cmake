@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_callsites.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_callsites.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_callsites.dir/test_logger_callsites.cc.o"
+  "CMakeFiles/test_logger_callsites.dir/test_logger_callsites.cc.o.d"
+  "test_logger_callsites"
+  "test_logger_callsites.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_callsites.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
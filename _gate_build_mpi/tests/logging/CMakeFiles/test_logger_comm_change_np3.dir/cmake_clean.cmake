@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_comm_change_np3.dir/__/gtest_mains/gTestMain_mpi.cc.o"
+  "CMakeFiles/test_logger_comm_change_np3.dir/__/gtest_mains/gTestMain_mpi.cc.o.d"
+  "CMakeFiles/test_logger_comm_change_np3.dir/test_logger_change_comm.cc.o"
+  "CMakeFiles/test_logger_comm_change_np3.dir/test_logger_change_comm.cc.o.d"
+  "test_logger_comm_change_np3"
+  "test_logger_comm_change_np3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_comm_change_np3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
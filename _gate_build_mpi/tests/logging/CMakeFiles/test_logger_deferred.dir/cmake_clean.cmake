@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_deferred.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_deferred.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_deferred.dir/test_logger_deferred.cc.o"
+  "CMakeFiles/test_logger_deferred.dir/test_logger_deferred.cc.o.d"
+  "test_logger_deferred"
+  "test_logger_deferred.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_deferred.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_environment.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_environment.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_environment.dir/test_logger_environment.cc.o"
+  "CMakeFiles/test_logger_environment.dir/test_logger_environment.cc.o.d"
+  "test_logger_environment"
+  "test_logger_environment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_environment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_formatting.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_formatting.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_formatting.dir/test_logger_formatting.cc.o"
+  "CMakeFiles/test_logger_formatting.dir/test_logger_formatting.cc.o.d"
+  "test_logger_formatting"
+  "test_logger_formatting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_formatting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/gtest_mains/gTestMain_serial.cc" "tests/logging/CMakeFiles/test_logger_include_order.dir/__/gtest_mains/gTestMain_serial.cc.o" "gcc" "tests/logging/CMakeFiles/test_logger_include_order.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "/root/repo/tests/logging/include_order.cc" "tests/logging/CMakeFiles/test_logger_include_order.dir/include_order.cc.o" "gcc" "tests/logging/CMakeFiles/test_logger_include_order.dir/include_order.cc.o.d"
+  "/root/repo/tests/logging/test_logger_include_order.cc" "tests/logging/CMakeFiles/test_logger_include_order.dir/test_logger_include_order.cc.o" "gcc" "tests/logging/CMakeFiles/test_logger_include_order.dir/test_logger_include_order.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_include_order.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_include_order.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_include_order.dir/include_order.cc.o"
+  "CMakeFiles/test_logger_include_order.dir/include_order.cc.o.d"
+  "CMakeFiles/test_logger_include_order.dir/test_logger_include_order.cc.o"
+  "CMakeFiles/test_logger_include_order.dir/test_logger_include_order.cc.o.d"
+  "test_logger_include_order"
+  "test_logger_include_order.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_include_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_macros.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_macros.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_macros.dir/macros_only.cc.o"
+  "CMakeFiles/test_logger_macros.dir/macros_only.cc.o.d"
+  "CMakeFiles/test_logger_macros.dir/test_logger_macros.cc.o"
+  "CMakeFiles/test_logger_macros.dir/test_logger_macros.cc.o.d"
+  "test_logger_macros"
+  "test_logger_macros.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_macros.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_macros_compiled.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_macros_compiled.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_macros_compiled.dir/macros_only.cc.o"
+  "CMakeFiles/test_logger_macros_compiled.dir/macros_only.cc.o.d"
+  "CMakeFiles/test_logger_macros_compiled.dir/test_logger_macros.cc.o"
+  "CMakeFiles/test_logger_macros_compiled.dir/test_logger_macros.cc.o.d"
+  "test_logger_macros_compiled"
+  "test_logger_macros_compiled.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_macros_compiled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
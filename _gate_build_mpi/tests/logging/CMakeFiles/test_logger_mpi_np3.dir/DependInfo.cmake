@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/gtest_mains/gTestMain_mpi.cc" "tests/logging/CMakeFiles/test_logger_mpi_np3.dir/__/gtest_mains/gTestMain_mpi.cc.o" "gcc" "tests/logging/CMakeFiles/test_logger_mpi_np3.dir/__/gtest_mains/gTestMain_mpi.cc.o.d"
+  "/root/repo/tests/logging/test_logger_mpi.cc" "tests/logging/CMakeFiles/test_logger_mpi_np3.dir/test_logger_mpi.cc.o" "gcc" "tests/logging/CMakeFiles/test_logger_mpi_np3.dir/test_logger_mpi.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_ranges.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_ranges.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_ranges.dir/test_logger_ranges.cc.o"
+  "CMakeFiles/test_logger_ranges.dir/test_logger_ranges.cc.o.d"
+  "test_logger_ranges"
+  "test_logger_ranges.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_ranges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_rate_limited.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_rate_limited.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_rate_limited.dir/test_logger_rate_limited.cc.o"
+  "CMakeFiles/test_logger_rate_limited.dir/test_logger_rate_limited.cc.o.d"
+  "test_logger_rate_limited"
+  "test_logger_rate_limited.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_rate_limited.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_serial_compiled.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_serial_compiled.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_serial_compiled.dir/test_logger_serial.cc.o"
+  "CMakeFiles/test_logger_serial_compiled.dir/test_logger_serial.cc.o.d"
+  "test_logger_serial_compiled"
+  "test_logger_serial_compiled.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_serial_compiled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
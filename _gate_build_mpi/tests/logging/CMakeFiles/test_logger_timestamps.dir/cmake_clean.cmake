@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_logger_timestamps.dir/__/gtest_mains/gTestMain_serial.cc.o"
+  "CMakeFiles/test_logger_timestamps.dir/__/gtest_mains/gTestMain_serial.cc.o.d"
+  "CMakeFiles/test_logger_timestamps.dir/test_logger_timestamps.cc.o"
+  "CMakeFiles/test_logger_timestamps.dir/test_logger_timestamps.cc.o.d"
+  "test_logger_timestamps"
+  "test_logger_timestamps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_logger_timestamps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/logging
+# Build directory: /root/repo/_gate_build_mpi/tests/logging
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_logger_serial "/root/repo/_gate_build_mpi/tests/logging/test_logger_serial")
+set_tests_properties(test_logger_serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;1;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_formatting "/root/repo/_gate_build_mpi/tests/logging/test_logger_formatting")
+set_tests_properties(test_logger_formatting PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;6;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_write_serial "/root/repo/_gate_build_mpi/tests/logging/test_logger_write_serial")
+set_tests_properties(test_logger_write_serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;11;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_binary "/root/repo/_gate_build_mpi/tests/logging/test_logger_binary")
+set_tests_properties(test_logger_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;16;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_active_level "/root/repo/_gate_build_mpi/tests/logging/test_logger_active_level")
+set_tests_properties(test_logger_active_level PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;21;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_allocations "/root/repo/_gate_build_mpi/tests/logging/test_logger_allocations")
+set_tests_properties(test_logger_allocations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;26;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_async "/root/repo/_gate_build_mpi/tests/logging/test_logger_async")
+set_tests_properties(test_logger_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;31;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_deferred "/root/repo/_gate_build_mpi/tests/logging/test_logger_deferred")
+set_tests_properties(test_logger_deferred PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;36;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_rate_limited "/root/repo/_gate_build_mpi/tests/logging/test_logger_rate_limited")
+set_tests_properties(test_logger_rate_limited PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;41;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_callsites "/root/repo/_gate_build_mpi/tests/logging/test_logger_callsites")
+set_tests_properties(test_logger_callsites PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;46;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_channels "/root/repo/_gate_build_mpi/tests/logging/test_logger_channels")
+set_tests_properties(test_logger_channels PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;51;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_environment "/root/repo/_gate_build_mpi/tests/logging/test_logger_environment")
+set_tests_properties(test_logger_environment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;56;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_timestamps "/root/repo/_gate_build_mpi/tests/logging/test_logger_timestamps")
+set_tests_properties(test_logger_timestamps PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;61;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_ranges "/root/repo/_gate_build_mpi/tests/logging/test_logger_ranges")
+set_tests_properties(test_logger_ranges PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;66;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_macros "/root/repo/_gate_build_mpi/tests/logging/test_logger_macros")
+set_tests_properties(test_logger_macros PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;71;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_include_order "/root/repo/_gate_build_mpi/tests/logging/test_logger_include_order")
+set_tests_properties(test_logger_include_order PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;77;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_bad_spec_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_bad_spec_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_bad_spec_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_missing_argument_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_missing_argument_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_missing_argument_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_string_format_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_string_format_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_string_format_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_array_format_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_array_format_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_array_format_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_string_format_macros_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_string_format_macros_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_string_format_macros_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;107;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_array_format_macros_cxx17 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_array_format_macros_cxx17" "--config" "")
+set_tests_properties(test_compile_fail_array_format_macros_cxx17 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;107;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_bad_spec_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_bad_spec_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_bad_spec_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_missing_argument_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_missing_argument_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_missing_argument_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_string_format_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_string_format_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_string_format_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_array_format_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_array_format_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_array_format_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;94;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_string_format_macros_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_string_format_macros_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_string_format_macros_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;107;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_array_format_macros_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_array_format_macros_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_array_format_macros_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;107;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_compile_fail_missing_argument_macros_cxx20 "/usr/bin/cmake" "--build" "/root/repo/_gate_build_mpi" "--target" "test_compile_fail_missing_argument_macros_cxx20" "--config" "")
+set_tests_properties(test_compile_fail_missing_argument_macros_cxx20 PROPERTIES  RUN_SERIAL "TRUE" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingTests.cmake;42;add_test;/root/repo/tests/logging/CMakeLists.txt;107;add_compile_fail_test;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_serial_compiled "/root/repo/_gate_build_mpi/tests/logging/test_logger_serial_compiled")
+set_tests_properties(test_logger_serial_compiled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;118;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_formatting_compiled "/root/repo/_gate_build_mpi/tests/logging/test_logger_formatting_compiled")
+set_tests_properties(test_logger_formatting_compiled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;118;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_callsites_compiled "/root/repo/_gate_build_mpi/tests/logging/test_logger_callsites_compiled")
+set_tests_properties(test_logger_callsites_compiled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;118;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_macros_compiled "/root/repo/_gate_build_mpi/tests/logging/test_logger_macros_compiled")
+set_tests_properties(test_logger_macros_compiled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;6;add_test;/root/repo/tests/logging/CMakeLists.txt;122;add_utest_serial;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_mpi_np3 "/usr/bin/mpiexec" "-n" "3" "test_logger_mpi_np3")
+set_tests_properties(test_logger_mpi_np3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;15;add_test;/root/repo/tests/logging/CMakeLists.txt;142;add_utest_mpi;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_comm_change_np3 "/usr/bin/mpiexec" "-n" "3" "test_logger_comm_change_np3")
+set_tests_properties(test_logger_comm_change_np3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;15;add_test;/root/repo/tests/logging/CMakeLists.txt;147;add_utest_mpi;/root/repo/tests/logging/CMakeLists.txt;0;")
+add_test(test_logger_write_mpi_np3 "/usr/bin/mpiexec" "-n" "3" "test_logger_write_mpi_np3")
+set_tests_properties(test_logger_write_mpi_np3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/cmake/macrosForCreatingUnitTests.cmake;15;add_test;/root/repo/tests/logging/CMakeLists.txt;152;add_utest_mpi;/root/repo/tests/logging/CMakeLists.txt;0;")
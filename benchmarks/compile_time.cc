@@ -0,0 +1,36 @@
+// A translation unit that uses pressio-log the way a pressio-rom source file
+// does: it includes core.hpp and logs a handful of messages of each kind.
+// Only compiled (not linked) by the compile-time benchmark.
+//
+// With PRESSIOLOG_BENCHMARK_BASELINE defined, only the macros and argument
+// types that every earlier version supports are used, so that the same code
+// can be compiled against a baseline (see compile_time.cmake).
+
+#include <string>
+#include <vector>
+
+#include <pressio-log/core.hpp>
+
+void solverStep(int iteration, double residual, const std::string& name) {
+    PRESSIOLOG_SPARSE("iteration {} residual {:.6e}", iteration, residual);
+    PRESSIOLOG_DEBUG("Residual {} (iteration {})", residual, iteration);
+    if (residual > 1.0e10) {
+        PRESSIOLOG_WARNING("Diverging at iteration {}", iteration);
+    }
+    #ifndef PRESSIOLOG_BENCHMARK_BASELINE
+    PRESSIOLOG_INFO("Step {} of {}", iteration, name);
+    #else
+    static_cast<void>(name);
+    #endif
+}
+
+void assemble(const std::vector<double>& values) {
+    PRESSIOLOG_INFO("Assembled {} values", values.size());
+    #ifndef PRESSIOLOG_BENCHMARK_BASELINE
+    PRESSIOLOG_DEBUG_CH("assembly", "Assembling {} values", values.size());
+    PRESSIOLOG_INFO_EVERY_N(100, "Assembled {} values", values.size());
+    #endif
+    if (values.empty()) {
+        PRESSIOLOG_ERROR("Nothing to assemble");
+    }
+}
@@ -0,0 +1,77 @@
+# Compiles SOURCE REPEAT times with PRESSIOLOG_COMPILED=0 (header-only) and
+# PRESSIOLOG_COMPILED=1 (compiled library), and reports the average times.
+# With BASELINE (a git revision of pressio-log), the header-only time is also
+# reported against that revision's, both compiling the code of SOURCE that
+# the baseline supports (PRESSIOLOG_BENCHMARK_BASELINE).
+# Run through the compile-time-benchmark target (see CMakeLists.txt).
+cmake_minimum_required(VERSION 3.23)
+
+separate_arguments(flags NATIVE_COMMAND "${FLAGS}")
+
+# Average wall time, in microseconds, of compiling SOURCE against the headers
+# of include_dir in the given mode, with the given extra flags
+function(time_compile include_dir mode extra result)
+  set(total 0)
+  foreach(i RANGE 1 ${REPEAT})
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+      COMMAND ${CXX} ${flags} ${extra} -I${include_dir} -DPRESSIOLOG_COMPILED=${mode}
+              -c ${SOURCE} -o ${OUTPUT_DIR}/compile_time_${mode}.o
+      RESULT_VARIABLE status)
+    string(TIMESTAMP end "%s%f")
+    if(NOT status EQUAL 0)
+      message(FATAL_ERROR "Compilation failed with PRESSIOLOG_COMPILED=${mode} (${include_dir})")
+    endif()
+    math(EXPR total "${total} + ${end} - ${start}")
+  endforeach()
+  math(EXPR average "${total} / ${REPEAT}")
+  set(${result} ${average} PARENT_SCOPE)
+endfunction()
+
+# Formats numerator / denominator with two decimals
+function(ratio numerator denominator result)
+  math(EXPR scaled "100 * ${numerator} / ${denominator}")
+  math(EXPR whole "${scaled} / 100")
+  math(EXPR fraction "${scaled} % 100")
+  if(fraction LESS 10)
+    set(fraction "0${fraction}")
+  endif()
+  set(${result} "${whole}.${fraction}" PARENT_SCOPE)
+endfunction()
+
+time_compile(${INCLUDE_DIR} 0 "" header_only)
+time_compile(${INCLUDE_DIR} 1 "" compiled)
+
+math(EXPR header_only_ms "${header_only} / 1000")
+math(EXPR compiled_ms "${compiled} / 1000")
+ratio(${header_only} ${compiled} speedup)
+
+message("pressio-log compile time per translation unit (${REPEAT} runs each):")
+message("    header-only: ${header_only_ms} ms")
+message("    compiled:    ${compiled_ms} ms")
+message("    speedup:     ${speedup}x")
+
+if(BASELINE)
+  # The baseline's headers, as of the given revision
+  set(baseline_dir ${OUTPUT_DIR}/baseline)
+  file(REMOVE_RECURSE ${baseline_dir})
+  file(MAKE_DIRECTORY ${baseline_dir})
+  execute_process(
+    COMMAND ${GIT} -C ${PROJECT_DIR} archive --format=tar -o ${baseline_dir}.tar ${BASELINE} include
+    RESULT_VARIABLE status)
+  if(NOT status EQUAL 0)
+    message(FATAL_ERROR "Could not read the headers of ${BASELINE}")
+  endif()
+  file(ARCHIVE_EXTRACT INPUT ${baseline_dir}.tar DESTINATION ${baseline_dir})
+
+  time_compile(${baseline_dir}/include 0 -DPRESSIOLOG_BENCHMARK_BASELINE baseline)
+  time_compile(${INCLUDE_DIR} 0 -DPRESSIOLOG_BENCHMARK_BASELINE current)
+
+  math(EXPR baseline_ms "${baseline} / 1000")
+  math(EXPR current_ms "${current} / 1000")
+  ratio(${current} ${baseline} relative)
+
+  message("header-only, against ${BASELINE} (the code it supports):")
+  message("    ${BASELINE}: ${baseline_ms} ms")
+  message("    current:     ${current_ms} ms (${relative}x)")
+endif()
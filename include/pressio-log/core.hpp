@@ -49,54 +49,22 @@
 #ifndef PRESSIOLOG_CORE_HPP_
 #define PRESSIOLOG_CORE_HPP_
 
-#include "./logger/logger_impl.hpp"
-
-///////////////////////////////////////////////////////////////////////////////
-// Standard logging macros
-
-#define LOG(level, ...) \
-   pressiolog::Logger::PressioLogger()->log(level, __VA_ARGS__);
-
-#define PRESSIOLOG_SPARSE(...)  LOG(pressiolog::LogLevel::sparse,  __VA_ARGS__)
-#define PRESSIOLOG_INFO(...)    LOG(pressiolog::LogLevel::info,    __VA_ARGS__)
-#define PRESSIOLOG_DEBUG(...)   LOG(pressiolog::LogLevel::debug,   __VA_ARGS__)
-#define PRESSIOLOG_WARNING(...) LOG(pressiolog::LogLevel::warning, __VA_ARGS__)
-#define PRESSIOLOG_ERROR(...)   LOG(pressiolog::LogLevel::error,   __VA_ARGS__)
-
-///////////////////////////////////////////////////////////////////////////////
-// Initialization/Finalization
-
-#if PRESSIO_ENABLE_TPL_MPI
-    #define PRESSIOLOG_INITIALIZE(...) \
-        pressiolog::Logger::PressioLogger()->initializeWithMPI(__VA_ARGS__)
+// The compiled library (pressio-log::compiled) defines PRESSIOLOG_COMPILED
+// and provides the Logger's non-template functions and fmt
+#if PRESSIOLOG_COMPILED
+    #include "./logger/logger_templates.hpp"
 #else
-    #define PRESSIOLOG_INITIALIZE(...) \
-        pressiolog::Logger::PressioLogger()->initialize(__VA_ARGS__)
+    #include "./logger/logger_impl.hpp"
 #endif
 
-#define PRESSIOLOG_FINALIZE(...) \
-    pressiolog::Logger::PressioLogger()->finalize(__VA_ARGS__)
-
-///////////////////////////////////////////////////////////////////////////////
-// Setters
-
-#define PRESSIOLOG_SET_LEVEL(...) \
-    pressiolog::Logger::PressioLogger()->setLoggingLevel(__VA_ARGS__)
-
-#define PRESSIOLOG_SET_OUTPUT_STREAM(...) \
-    pressiolog::Logger::PressioLogger()->setOutputStream(__VA_ARGS__)
-
-#define PRESSIOLOG_SET_OUTPUT_FILENAME(...) \
-    pressiolog::Logger::PressioLogger()->setOutputFilename(__VA_ARGS__)
-
-#if PRESSIO_ENABLE_TPL_MPI
+// Format strings of the logging macros checked by fmt (see frontend.hpp)
+#include "./logger/checkedformat.hpp"
 
-    #define PRESSIOLOG_SET_LOGGING_RANK(...) \
-        pressiolog::Logger::PressioLogger()->setLoggingRank(__VA_ARGS__)
+// Formatting of vectors and matrices in messages (pressiolog::range, matrix)
+#include "./logger/rangeformat.hpp"
 
-    #define PRESSIOLOG_SET_COMMUNICATOR(...) \
-        pressiolog::Logger::PressioLogger()->setCommunicator(__VA_ARGS__)
+#include "macros.hpp"
 
-#endif // PRESSIO_ENABLE_TPL_MPI
+#include "./logger/controlmacros.hpp"
 
 #endif // PRESSIOLOG_CORE_HPP
@@ -4,7 +4,10 @@
 #ifndef FMT_FMT_H_
 #define FMT_FMT_H_
 
-#define FMT_HEADER_ONLY
+// The compiled pressio-log library builds fmt once (see src/pressio-log.cc)
+#if !PRESSIOLOG_COMPILED
+    #define FMT_HEADER_ONLY
+#endif
 
 #if PRESSIO_ENABLE_EXTERNAL_FMT
     #include <fmt/format.h>
@@ -0,0 +1,118 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// argformat.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_ARGFORMAT_HPP_
+#define PRESSIOLOG_LOGGER_ARGFORMAT_HPP_
+
+#include <pressio-log/fmt/fmt.h>
+
+#include <string_view>
+
+#include "argpack.hpp"
+
+namespace pressiolog { namespace argpack {
+
+namespace detail {
+
+template <typename T>
+fmt::basic_format_arg<fmt::format_context> makeArg(const T& value) {
+    #if FMT_VERSION >= 110000
+    return fmt::basic_format_arg<fmt::format_context>(value);
+    #else
+    return fmt::detail::make_arg<fmt::format_context>(value);
+    #endif
+}
+
+} // end namespace detail
+
+// Formats fmt_str with arguments packed by packAll(), appending to out
+inline void format(fmt::memory_buffer& out, std::string_view fmt_str, std::string_view packed) {
+    fmt::basic_format_arg<fmt::format_context> args[max_args];
+    const char* pos = packed.data();
+    const int count = static_cast<unsigned char>(*pos++);
+    for (int i = 0; i < count; ++i) {
+        switch (static_cast<ArgType>(*pos++)) {
+            case ArgType::int32:       args[i] = detail::makeArg(detail::readRaw<std::int32_t>(pos));  break;
+            case ArgType::uint32:      args[i] = detail::makeArg(detail::readRaw<std::uint32_t>(pos)); break;
+            case ArgType::int64:       args[i] = detail::makeArg(detail::readRaw<long long>(pos));     break;
+            case ArgType::uint64:      args[i] = detail::makeArg(detail::readRaw<unsigned long long>(pos)); break;
+            case ArgType::boolean:     args[i] = detail::makeArg(detail::readRaw<bool>(pos));          break;
+            case ArgType::character:   args[i] = detail::makeArg(detail::readRaw<char>(pos));          break;
+            case ArgType::float32:     args[i] = detail::makeArg(detail::readRaw<float>(pos));         break;
+            case ArgType::float64:     args[i] = detail::makeArg(detail::readRaw<double>(pos));        break;
+            case ArgType::long_double: args[i] = detail::makeArg(detail::readRaw<long double>(pos));   break;
+            case ArgType::pointer:     args[i] = detail::makeArg(detail::readRaw<const void*>(pos));   break;
+            case ArgType::string: {
+                const auto size = detail::readRaw<std::uint32_t>(pos);
+                args[i] = detail::makeArg(fmt::string_view(pos, size));
+                pos += size;
+                break;
+            }
+        }
+    }
+    fmt::vformat_to(fmt::appender(out), fmt::string_view(fmt_str.data(), fmt_str.size()),
+                    fmt::format_args(args, count));
+}
+
+// Like format(), but a format error is written to the output instead of thrown
+// (used where the caller can no longer be told about it)
+inline void tryFormat(fmt::memory_buffer& out, std::string_view fmt_str, std::string_view packed) {
+    const auto start = out.size();
+    try {
+        format(out, fmt_str, packed);
+    } catch (const fmt::format_error& e) {
+        out.resize(start);
+        fmt::format_to(
+            fmt::appender(out), "fmt could not format given string: {} ({})",
+            fmt_str, e.what());
+    }
+}
+
+}} // end namespace pressiolog::argpack
+
+#endif // PRESSIOLOG_LOGGER_ARGFORMAT_HPP_
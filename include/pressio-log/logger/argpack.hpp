@@ -0,0 +1,234 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// argpack.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_ARGPACK_HPP_
+#define PRESSIOLOG_LOGGER_ARGPACK_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace pressiolog { namespace argpack {
+
+/*
+ * Serialization of formatting arguments into a compact byte string, so that
+ * formatting can happen later (on the background thread, or offline).
+ *
+ * Layout: one byte with the argument count, then for each argument a type
+ * tag followed by its raw bytes. Strings are stored as a 32-bit length and
+ * their characters, so the packed arguments never refer to the caller's memory.
+ * The bytes are in the host's layout (byte order, size of bool, pointers and
+ * long double), so binary logs record the host they were written on.
+ *
+ * Packing does not depend on fmt, so that translation units that only include
+ * macros.hpp can use it; the arguments are formatted by argformat.hpp.
+ */
+
+enum class ArgType : std::uint8_t {
+    int32,
+    uint32,
+    int64,
+    uint64,
+    boolean,
+    character,
+    float32,
+    float64,
+    long_double,
+    string,
+    pointer
+};
+
+// Maximum number of arguments a packed record can hold
+inline constexpr std::size_t max_args = 16;
+
+namespace detail {
+
+template <typename T>
+constexpr ArgType argTypeOf() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return ArgType::boolean;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return ArgType::character;
+    } else if constexpr (std::is_integral_v<T> and std::is_signed_v<T>) {
+        return sizeof(T) <= 4 ? ArgType::int32 : ArgType::int64;
+    } else if constexpr (std::is_integral_v<T>) {
+        return sizeof(T) <= 4 ? ArgType::uint32 : ArgType::uint64;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return ArgType::float32;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return ArgType::float64;
+    } else if constexpr (std::is_same_v<T, long double>) {
+        return ArgType::long_double;
+    } else if constexpr (std::is_pointer_v<T> and std::is_void_v<std::remove_pointer_t<T>>) {
+        return ArgType::pointer;
+    } else {
+        return ArgType::string;
+    }
+}
+
+// Buffer is a std::string or a fmt::memory_buffer (anything with push_back and append)
+template <typename Buffer, typename T>
+void appendRaw(Buffer& out, const T& value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    out.append(bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T readRaw(const char*& pos) {
+    T value;
+    std::memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+} // end namespace detail
+
+// Whether an argument of type T (as passed to fmt) can be packed
+template <typename T, typename D = std::decay_t<T>>
+inline constexpr bool is_packable_v =
+       (std::is_arithmetic_v<D>
+        and not std::is_same_v<D, wchar_t>
+        and not std::is_same_v<D, char16_t>
+        and not std::is_same_v<D, char32_t>)
+    or std::is_same_v<D, const char*>
+    or std::is_same_v<D, char*>
+    or std::is_same_v<D, std::string>
+    or std::is_same_v<D, std::string_view>
+    or std::is_same_v<D, const void*>
+    or std::is_same_v<D, void*>;
+
+template <typename... Args>
+inline constexpr bool are_packable_v =
+    sizeof...(Args) <= max_args and (is_packable_v<Args> and ...);
+
+// Appends a single argument
+template <typename Buffer, typename T>
+void pack(Buffer& out, const T& value) {
+    using D = std::decay_t<T>;
+    constexpr ArgType type = detail::argTypeOf<D>();
+    out.push_back(static_cast<char>(type));
+    if constexpr (type == ArgType::string) {
+        std::string_view str;
+        if constexpr (std::is_array_v<T>) {
+            str = std::string_view(value);
+        } else if constexpr (std::is_pointer_v<D>) {
+            str = value ? std::string_view(value) : std::string_view();
+        } else {
+            str = std::string_view(value.data(), value.size());
+        }
+        detail::appendRaw(out, static_cast<std::uint32_t>(str.size()));
+        out.append(str.data(), str.data() + str.size());
+    } else if constexpr (type == ArgType::int32) {
+        detail::appendRaw(out, static_cast<std::int32_t>(value));
+    } else if constexpr (type == ArgType::uint32) {
+        detail::appendRaw(out, static_cast<std::uint32_t>(value));
+    } else if constexpr (type == ArgType::int64) {
+        detail::appendRaw(out, static_cast<std::int64_t>(value));
+    } else if constexpr (type == ArgType::uint64) {
+        detail::appendRaw(out, static_cast<std::uint64_t>(value));
+    } else if constexpr (type == ArgType::pointer) {
+        detail::appendRaw(out, static_cast<const void*>(value));
+    } else {
+        detail::appendRaw(out, value);
+    }
+}
+
+// Appends the argument count and all arguments
+template <typename Buffer, typename... Args>
+void packAll(Buffer& out, const Args&... args) {
+    static_assert(are_packable_v<Args...>, "arguments cannot be packed");
+    out.push_back(static_cast<char>(sizeof...(Args)));
+    (pack(out, args), ...);
+}
+
+// Returns the number of bytes taken by the packed arguments at the start of
+// data, or 0 if they are malformed or truncated
+inline std::size_t packedSize(std::string_view data) {
+    const char* pos = data.data();
+    const char* end = pos + data.size();
+    auto take = [&](std::size_t n) {
+        if (static_cast<std::size_t>(end - pos) < n) return false;
+        pos += n;
+        return true;
+    };
+    if (!take(1)) return 0;
+    const int count = static_cast<unsigned char>(data[0]);
+    if (count > static_cast<int>(max_args)) return 0;
+    for (int i = 0; i < count; ++i) {
+        if (!take(1)) return 0;
+        std::size_t size = 0;
+        switch (static_cast<ArgType>(pos[-1])) {
+            case ArgType::int32:       size = sizeof(std::int32_t);  break;
+            case ArgType::uint32:      size = sizeof(std::uint32_t); break;
+            case ArgType::int64:       size = sizeof(std::int64_t);  break;
+            case ArgType::uint64:      size = sizeof(std::uint64_t); break;
+            case ArgType::boolean:     size = sizeof(bool);          break;
+            case ArgType::character:   size = sizeof(char);          break;
+            case ArgType::float32:     size = sizeof(float);         break;
+            case ArgType::float64:     size = sizeof(double);        break;
+            case ArgType::long_double: size = sizeof(long double);   break;
+            case ArgType::pointer:     size = sizeof(const void*);   break;
+            case ArgType::string: {
+                if (static_cast<std::size_t>(end - pos) < sizeof(std::uint32_t)) return 0;
+                size = sizeof(std::uint32_t) + detail::readRaw<std::uint32_t>(pos);
+                pos -= sizeof(std::uint32_t);
+                break;
+            }
+            default:
+                return 0;
+        }
+        if (!take(size)) return 0;
+    }
+    return static_cast<std::size_t>(pos - data.data());
+}
+
+}} // end namespace pressiolog::argpack
+
+#endif // PRESSIOLOG_LOGGER_ARGPACK_HPP_
@@ -0,0 +1,173 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// asyncqueue.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_ASYNCQUEUE_HPP_
+#define PRESSIOLOG_LOGGER_ASYNCQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace pressiolog {
+
+/*
+ * Bounded lock-free multi-producer/multi-consumer queue.
+ *
+ * Based on Dmitry Vyukov's bounded MPMC queue: each slot carries a sequence
+ * number that tells producers and consumers whether it is free or filled,
+ * so pushing or popping costs one CAS on the shared position plus one
+ * release store on the slot. Slots are filled and consumed in place, which
+ * lets them keep their storage (e.g. string capacity) between uses.
+ *
+ *     https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ */
+template <typename T>
+class AsyncQueue {
+    public:
+        // The capacity is rounded up to a power of two
+        explicit AsyncQueue(std::size_t capacity) {
+            std::size_t size = 2;
+            while (size < capacity) {
+                size *= 2;
+            }
+            mask_ = size - 1;
+            slots_.reset(new Slot[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        AsyncQueue(const AsyncQueue&) = delete;
+        AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+        std::size_t capacity() const {
+            return mask_ + 1;
+        }
+
+        // Calls fill(T&) on a free slot and publishes it.
+        // Returns false (without calling fill) if the queue is full.
+        template <typename Fill>
+        bool tryPush(Fill&& fill) {
+            std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            Slot* slot;
+            while (true) {
+                slot = &slots_[pos & mask_];
+                std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0) {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            fill(slot->value);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Calls consume(T&) on the oldest published slot and frees it.
+        // Returns false (without calling consume) if no slot is ready.
+        template <typename Consume>
+        bool tryPop(Consume&& consume) {
+            std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+            Slot* slot;
+            while (true) {
+                slot = &slots_[pos & mask_];
+                std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0) {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            consume(slot->value);
+            slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Total number of pushes so far (including ones still being filled)
+        std::size_t pushed() const {
+            return enqueue_pos_.load(std::memory_order_acquire);
+        }
+
+        // Gives each slot's value a chance to preallocate storage
+        template <typename Init>
+        void initializeSlots(Init&& init) {
+            for (std::size_t i = 0; i <= mask_; ++i) {
+                init(slots_[i].value);
+            }
+        }
+
+    private:
+        static constexpr std::size_t cache_line_size_ = 64;
+
+        struct Slot {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t mask_{0};
+
+        // Keep the producer and consumer positions on separate cache lines
+        alignas(cache_line_size_) std::atomic<std::size_t> enqueue_pos_{0};
+        alignas(cache_line_size_) std::atomic<std::size_t> dequeue_pos_{0};
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_ASYNCQUEUE_HPP_
@@ -0,0 +1,439 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// binarylog.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_BINARYLOG_HPP_
+#define PRESSIOLOG_LOGGER_BINARYLOG_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <pressio-log/fmt/fmt.h>
+
+#include "loglevel.hpp"
+#include "argformat.hpp"
+#include "colors.hpp"
+
+namespace pressiolog { namespace binlog {
+
+/*
+ * Compact binary log format (FileFormat::binary).
+ *
+ * Instead of formatted lines, the file holds the format string of each
+ * callsite once, and for every message only the callsite id, a timestamp,
+ * the rank, and the raw argument bytes. pressio-log-decode turns the file
+ * back into the text the logger would have written.
+ *
+ * A file is a sequence of sessions (one per time the file is opened), each
+ * starting with a header record. Callsite ids are local to their session.
+ * The encoder finds a message's callsite record by the id of the logging
+ * macro's Callsite when its format string is a literal, and by the content
+ * of the format string otherwise.
+ *
+ *   header:   kind, "PLOGBIN", version, flags, host, start time
+ *   callsite: kind, id, level, format string length, format string
+ *   message:  kind, id, time delta, rank, packed arguments (see argpack.hpp)
+ *   text:     kind, level, time delta, line length, line
+ *
+ * The packed arguments are the raw bytes of the host that wrote them, so a
+ * binary log can only be decoded on the same kind of host. The header's host
+ * field records what their layout depends on (see hostLayout()), and the
+ * decoder rejects a file written on a different kind of host.
+ *
+ * No header flags are defined yet: they are written as 0 and ignored.
+ *
+ * The start time is a little-endian 64-bit count of nanoseconds since the
+ * epoch. Ids, ranks, lengths and time deltas are LEB128 varints; time deltas
+ * (relative to the previous record) are zigzag encoded, since records
+ * timestamped by different threads may be written slightly out of order.
+ * Messages whose arguments cannot be packed are stored as text records
+ * holding the finished line.
+ */
+
+enum class RecordKind : std::uint8_t {
+    header   = 0,
+    callsite = 1,
+    message  = 2,
+    text     = 3
+};
+
+inline constexpr std::string_view magic = "PLOGBIN";
+inline constexpr std::uint8_t format_version = 2;
+
+// Callsite id of messages that are looked up by format string
+inline constexpr std::size_t no_callsite = ~std::size_t(0);
+
+// What the layout of packed arguments depends on: byte order (1 for little
+// endian, 2 for big endian), the sizes of bool, pointers, and long double,
+// and the number of mantissa bits of long double (64 for x87's extended
+// precision, 113 for quadruple precision, ...)
+using HostLayout = std::array<std::uint8_t, 5>;
+
+inline HostLayout hostLayout() {
+    const std::uint16_t probe = 1;
+    std::uint8_t first_byte;
+    std::memcpy(&first_byte, &probe, 1);
+    return {static_cast<std::uint8_t>(first_byte == 1 ? 1 : 2),
+            static_cast<std::uint8_t>(sizeof(bool)),
+            static_cast<std::uint8_t>(sizeof(void*)),
+            static_cast<std::uint8_t>(sizeof(long double)),
+            static_cast<std::uint8_t>(std::numeric_limits<long double>::digits)};
+}
+
+inline std::string describe(const HostLayout& host) {
+    return fmt::format(
+        "{}-endian, {}-byte bool, {}-byte pointers, {}-byte long double with {} mantissa bits",
+        host[0] == 1 ? "little" : "big", host[1], host[2], host[3], host[4]);
+}
+
+namespace detail {
+
+inline void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+inline std::uint64_t zigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+// Bounds-checked reading of a binary log
+class Reader {
+    public:
+        explicit Reader(std::string_view data) : data_(data) {}
+
+        bool done() const { return pos_ == data_.size(); }
+        std::size_t position() const { return pos_; }
+        std::string_view rest() const { return data_.substr(pos_); }
+
+        std::uint8_t byte() {
+            need_(1);
+            return static_cast<std::uint8_t>(data_[pos_++]);
+        }
+
+        std::uint64_t varint() {
+            std::uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                const std::uint8_t b = byte();
+                value |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+                if (!(b & 0x80)) return value;
+            }
+            throw std::runtime_error(fmt::format("malformed varint at byte {}", pos_));
+        }
+
+        std::int64_t int64() {
+            std::int64_t value = 0;
+            for (int i = 0; i < 8; ++i) {
+                value |= static_cast<std::int64_t>(byte()) << (8 * i);
+            }
+            return value;
+        }
+
+        std::string_view bytes(std::size_t size) {
+            need_(size);
+            auto view = data_.substr(pos_, size);
+            pos_ += size;
+            return view;
+        }
+
+    private:
+        void need_(std::size_t size) const {
+            if (data_.size() - pos_ < size) {
+                throw std::runtime_error(fmt::format("truncated record at byte {}", pos_));
+            }
+        }
+
+        std::string_view data_;
+        std::size_t pos_{0};
+};
+
+} // end namespace detail
+
+/*
+ * Turns messages into binary records, keeping the callsite dictionary of the
+ * current session. Not thread safe: the Logger serializes access.
+ */
+class Encoder {
+    public:
+        // Starts a new session: the next record is preceded by a header
+        void reset() {
+            by_callsite_.clear();
+            by_format_.clear();
+            formats_.clear();
+            next_id_ = 0;
+            header_pending_ = true;
+        }
+
+        // Appends a message record (and the callsite record on first use).
+        // callsite_id is the id of the logging macro's Callsite if fmt_str
+        // is the same on every call from it, and no_callsite otherwise.
+        void message(std::string& out, LogLevel level, std::int64_t time, int rank,
+                     std::size_t callsite_id, std::string_view fmt_str, std::string_view packed) {
+            begin_(out, time);
+            auto& ids = callsite_id == no_callsite ? idsOfFormat_(fmt_str) : idsOfCallsite_(callsite_id);
+            const auto id = recordId_(out, ids, level, fmt_str);
+            out.push_back(static_cast<char>(RecordKind::message));
+            detail::putVarint(out, id);
+            putTime_(out, time);
+            detail::putVarint(out, static_cast<std::uint64_t>(rank));
+            out.append(packed.data(), packed.size());
+        }
+
+        // Appends a text record holding a finished line
+        void text(std::string& out, LogLevel level, std::int64_t time, std::string_view line) {
+            begin_(out, time);
+            out.push_back(static_cast<char>(RecordKind::text));
+            out.push_back(static_cast<char>(level));
+            putTime_(out, time);
+            detail::putVarint(out, line.size());
+            out.append(line.data(), line.size());
+        }
+
+    private:
+        void begin_(std::string& out, std::int64_t time) {
+            if (!header_pending_) {
+                return;
+            }
+            const std::uint8_t flags = 0;
+            out.push_back(static_cast<char>(RecordKind::header));
+            out.append(magic.data(), magic.size());
+            out.push_back(static_cast<char>(format_version));
+            out.push_back(static_cast<char>(flags));
+            for (const auto byte : hostLayout()) {
+                out.push_back(static_cast<char>(byte));
+            }
+            for (int i = 0; i < 8; ++i) {
+                out.push_back(static_cast<char>(static_cast<std::uint64_t>(time) >> (8 * i)));
+            }
+            last_time_ = time;
+            header_pending_ = false;
+        }
+
+        void putTime_(std::string& out, std::int64_t time) {
+            detail::putVarint(out, detail::zigzag(time - last_time_));
+            last_time_ = time;
+        }
+
+        // One id per level a format string is used with
+        using Ids = std::array<std::uint64_t, 6>;
+        static constexpr std::uint64_t unregistered_ = ~std::uint64_t(0);
+
+        Ids& idsOfCallsite_(std::size_t callsite_id) {
+            if (callsite_id >= by_callsite_.size()) {
+                Ids none;
+                none.fill(unregistered_);
+                by_callsite_.resize(callsite_id + 1, none);
+            }
+            return by_callsite_[callsite_id];
+        }
+
+        // Format strings built at run time are compared by content, so they
+        // get a new id whenever they change
+        Ids& idsOfFormat_(std::string_view fmt_str) {
+            auto it = by_format_.find(fmt_str);
+            if (it == by_format_.end()) {
+                const auto& stored = formats_.emplace_back(fmt_str);
+                it = by_format_.emplace(std::string_view(stored), Ids{}).first;
+                it->second.fill(unregistered_);
+            }
+            return it->second;
+        }
+
+        std::uint64_t recordId_(std::string& out, Ids& ids, LogLevel level, std::string_view fmt_str) {
+            auto& id = ids[static_cast<std::size_t>(level)];
+            if (id == unregistered_) {
+                id = next_id_++;
+                out.push_back(static_cast<char>(RecordKind::callsite));
+                detail::putVarint(out, id);
+                out.push_back(static_cast<char>(level));
+                detail::putVarint(out, fmt_str.size());
+                out.append(fmt_str.data(), fmt_str.size());
+            }
+            return id;
+        }
+
+        // Indexed by Callsite id
+        std::vector<Ids> by_callsite_;
+        // The deque keeps the keys of by_format_ valid as it grows
+        std::deque<std::string> formats_;
+        std::unordered_map<std::string_view, Ids> by_format_;
+        std::uint64_t next_id_{0};
+        std::int64_t last_time_{0};
+        bool header_pending_{true};
+};
+
+struct DecodeOptions {
+    // Prefix every line with its time (seconds since the epoch)
+    bool timestamps{false};
+};
+
+/*
+ * Writes the text of every record in a binary log to os, one line per
+ * message, exactly as the logger would have written it to a text file.
+ * Throws std::runtime_error if the data is not a valid binary log.
+ */
+inline void decode(std::string_view data, std::ostream& os, const DecodeOptions& options = {}) {
+    struct Callsite {
+        LogLevel level;
+        std::string_view fmt_str;
+    };
+    std::unordered_map<std::uint64_t, Callsite> callsites;
+    std::int64_t time = 0;
+    fmt::memory_buffer line;
+
+    auto emit = [&]() {
+        line.push_back('\n');
+        os.write(line.data(), static_cast<std::streamsize>(line.size()));
+    };
+
+    detail::Reader reader(data);
+    if (data.empty() or static_cast<RecordKind>(data[0]) != RecordKind::header) {
+        throw std::runtime_error("not a pressio-log binary log");
+    }
+    while (!reader.done()) {
+        const auto record_start = reader.position();
+        const auto kind = static_cast<RecordKind>(reader.byte());
+        line.clear();
+        switch (kind) {
+            case RecordKind::header: {
+                if (reader.bytes(magic.size()) != magic) {
+                    throw std::runtime_error("not a pressio-log binary log");
+                }
+                const auto version = reader.byte();
+                if (version != format_version) {
+                    throw std::runtime_error(fmt::format(
+                        "unsupported binary log version {}", version));
+                }
+                reader.byte(); // flags
+                HostLayout host;
+                for (auto& byte : host) {
+                    byte = reader.byte();
+                }
+                if (host != hostLayout()) {
+                    throw std::runtime_error(fmt::format(
+                        "binary log written on a different kind of host ({}), "
+                        "which this host ({}) cannot decode",
+                        describe(host), describe(hostLayout())));
+                }
+                time = reader.int64();
+                callsites.clear();
+                break;
+            }
+            case RecordKind::callsite: {
+                const auto id = reader.varint();
+                const auto level = static_cast<LogLevel>(reader.byte());
+                const auto size = reader.varint();
+                callsites[id] = Callsite{level, reader.bytes(size)};
+                break;
+            }
+            case RecordKind::message: {
+                const auto id = reader.varint();
+                time += detail::unzigzag(reader.varint());
+                const auto rank = reader.varint();
+                const auto packed_size = argpack::packedSize(reader.rest());
+                if (packed_size == 0) {
+                    throw std::runtime_error(fmt::format(
+                        "malformed arguments in record at byte {}", record_start));
+                }
+                const auto packed = reader.bytes(packed_size);
+                const auto it = callsites.find(id);
+                if (it == callsites.end()) {
+                    throw std::runtime_error(fmt::format(
+                        "unknown callsite {} in record at byte {}", id, record_start));
+                }
+                const auto level = it->second.level;
+                if (options.timestamps) {
+                    fmt::format_to(fmt::appender(line), "{}.{:09} ",
+                                   time / 1000000000, time % 1000000000);
+                }
+                // Mirrors LogLine::render, without colors (as in a text file)
+                fmt::format_to(fmt::appender(line), "[{}] ", rank);
+                line.append(colors::prefix(level, false));
+                argpack::tryFormat(line, it->second.fmt_str, packed);
+                emit();
+                break;
+            }
+            case RecordKind::text: {
+                reader.byte(); // level
+                time += detail::unzigzag(reader.varint());
+                const auto size = reader.varint();
+                const auto text = reader.bytes(size);
+                if (options.timestamps) {
+                    fmt::format_to(fmt::appender(line), "{}.{:09} ",
+                                   time / 1000000000, time % 1000000000);
+                }
+                line.append(text);
+                emit();
+                break;
+            }
+            default:
+                throw std::runtime_error(fmt::format(
+                    "unknown record type {} at byte {}",
+                    static_cast<int>(kind), record_start));
+        }
+    }
+}
+
+}} // end namespace pressiolog::binlog
+
+#endif // PRESSIOLOG_LOGGER_BINARYLOG_HPP_
@@ -0,0 +1,113 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// buffer.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_BUFFER_HPP_
+#define PRESSIOLOG_LOGGER_BUFFER_HPP_
+
+#include <pressio-log/fmt/fmt.h>
+
+#include <string_view>
+
+namespace pressiolog { namespace utils {
+
+/*
+ * Gives access to a thread-local buffer that log records are assembled in.
+ *
+ * The buffer keeps its capacity between messages, so once it has grown to fit
+ * the longest message, formatting a record no longer allocates. If the buffer
+ * is already in use on this thread (e.g. an argument's operator<< logs),
+ * the nested record is assembled in a local buffer instead.
+ */
+class ScopedBuffer {
+    public:
+        ScopedBuffer() {
+            auto& state = threadState_();
+            if (!state.in_use) {
+                state.in_use = true;
+                buffer_ = &state.buffer;
+                buffer_->clear();
+            } else {
+                buffer_ = &local_buffer_;
+            }
+        }
+
+        ~ScopedBuffer() {
+            if (buffer_ != &local_buffer_) {
+                threadState_().in_use = false;
+            }
+        }
+
+        ScopedBuffer(const ScopedBuffer&) = delete;
+        ScopedBuffer& operator=(const ScopedBuffer&) = delete;
+
+        fmt::memory_buffer& get() {
+            return *buffer_;
+        }
+
+        std::string_view view() const {
+            return std::string_view(buffer_->data(), buffer_->size());
+        }
+
+    private:
+        struct ThreadState {
+            fmt::memory_buffer buffer;
+            bool in_use{false};
+        };
+
+        static ThreadState& threadState_() {
+            thread_local ThreadState state;
+            return state;
+        }
+
+        fmt::memory_buffer* buffer_{nullptr};
+        fmt::memory_buffer local_buffer_;
+};
+
+}} // end namespace pressiolog::utils
+
+#endif // PRESSIOLOG_LOGGER_BUFFER_HPP_
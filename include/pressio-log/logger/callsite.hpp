@@ -0,0 +1,224 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// callsite.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_CALLSITE_HPP_
+#define PRESSIOLOG_LOGGER_CALLSITE_HPP_
+
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "loglevel.hpp"
+#include "config.hpp"
+#include "frontend.hpp"
+
+namespace pressiolog {
+
+// Per-callsite override of the logging level
+enum class CallsiteState : std::uint8_t {
+    level,    // follow the logging level (the default)
+    enabled,  // emit at any logging level
+    disabled  // never emit
+};
+
+constexpr std::string_view toString(CallsiteState state) {
+    switch (state) {
+        case CallsiteState::level:    return "level";
+        case CallsiteState::enabled:  return "enabled";
+        case CallsiteState::disabled: return "disabled";
+        default:                      return "unknown";
+    }
+}
+
+/*
+ * Static descriptor of one logging macro expansion.
+ *
+ * Each LOG macro owns a constant-initialized static Callsite, so it costs no
+ * guard check. The descriptor registers itself with the Logger the first
+ * time it runs, and from then on caches the most verbose level it lets
+ * through, which the Logger recomputes whenever the configuration, a
+ * channel level, or a callsite override changes. Checking a message is then a single load.
+ */
+class Callsite {
+    public:
+        constexpr Callsite(LogLevel level, const char* file, int line,
+                           const char* function, const char* format, const char* channel = "")
+            : level_(level), file_(file), line_(line), function_(function), format_(format),
+              channel_(channel) {}
+
+        Callsite(const Callsite&) = delete;
+        Callsite& operator=(const Callsite&) = delete;
+
+        // The first call registers the callsite with the Logger (see frontend.hpp)
+        bool enabled(LogLevel level) {
+            const std::uint8_t threshold = threshold_.load(std::memory_order_relaxed);
+            if (threshold == unregistered_) {
+                const auto register_callsite = frontend::entry_points.register_callsite;
+                if (register_callsite == nullptr) {
+                    frontend::warnUninitialized();
+                    return false;
+                }
+                return register_callsite(*this, level);
+            }
+            return passes_(level, threshold);
+        }
+
+        // Level of the macro (of its first call, for LOG with a runtime level)
+        LogLevel level() const { return level_; }
+        const char* file() const { return file_; }
+        int line() const { return line_; }
+        const char* function() const { return function_; }
+        // Source text of the format argument
+        const char* format() const { return format_; }
+        // Channel name ("" for messages without a channel)
+        const char* channel() const { return channel_; }
+
+    private:
+        friend class Logger;
+
+        static bool passes_(LogLevel level, std::uint8_t threshold) {
+            return level != LogLevel::none and static_cast<std::uint8_t>(level) <= threshold;
+        }
+
+        // Most verbose level emitted for the given configuration (whose level
+        // is that of the callsite's channel) and override
+        static std::uint8_t thresholdFor_(ConfigSnapshot config, CallsiteState state) {
+            if (state == CallsiteState::disabled) {
+                return 0;
+            }
+            // Let calls through before initialization so that log() can warn about it
+            if (!config.initialized() or (state == CallsiteState::enabled and config.loggingRank())) {
+                return static_cast<std::uint8_t>(LogLevel::debug);
+            }
+            return config.loggingRank() ? static_cast<std::uint8_t>(config.level()) : 0;
+        }
+
+        static constexpr std::uint8_t unregistered_ = 0xff;
+
+        const LogLevel level_;
+        const char* const file_;
+        const int line_;
+        const char* const function_;
+        const char* const format_;
+        const char* const channel_;
+        std::atomic<std::uint8_t> threshold_{unregistered_};
+
+        // Set once, when the callsite registers; atomic because the Logger
+        // also reads it while logging (see Logger::logPrepacked_)
+        static constexpr std::size_t no_id_ = ~std::size_t(0);
+        std::atomic<std::size_t> id_{no_id_};
+
+        // Guarded by the Logger's callsite mutex
+        CallsiteState state_{CallsiteState::level};
+        Callsite* next_{nullptr};
+};
+
+// Snapshot of a registered callsite, as returned by Logger::callsites()
+struct CallsiteInfo {
+    std::size_t id;
+    LogLevel level;
+    const char* file;
+    int line;
+    const char* function;
+    const char* format;
+    const char* channel;
+    CallsiteState state;
+    // Whether a message from this callsite is currently emitted on this rank
+    bool enabled;
+};
+
+namespace detail {
+
+// Matches text against a pattern where '*' matches any sequence of
+// characters and '?' matches any single character
+inline bool globMatch(std::string_view pattern, std::string_view text) {
+    std::size_t p = 0, t = 0;
+    std::size_t star = std::string_view::npos, resume = 0;
+    while (t < text.size()) {
+        if (p < pattern.size() and (pattern[p] == '?' or pattern[p] == text[t])) {
+            ++p;
+            ++t;
+        } else if (p < pattern.size() and pattern[p] == '*') {
+            star = p++;
+            resume = t;
+        } else if (star != std::string_view::npos) {
+            p = star + 1;
+            t = ++resume;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() and pattern[p] == '*') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+// A pattern selects a callsite if it matches its file, its function, or
+// "file:line" (e.g. "*/solvers/*", "solve", "*newton.hpp:42")
+inline bool matchesCallsite(std::string_view pattern, const Callsite& callsite) {
+    if (globMatch(pattern, callsite.file()) or globMatch(pattern, callsite.function())) {
+        return true;
+    }
+    const auto colon = pattern.rfind(':');
+    if (colon == std::string_view::npos) {
+        return false;
+    }
+    char line[16];
+    const auto result = std::to_chars(line, line + sizeof(line), callsite.line());
+    return globMatch(pattern.substr(0, colon), callsite.file())
+       and globMatch(pattern.substr(colon + 1), std::string_view(line, result.ptr - line));
+}
+
+} // end namespace detail
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_CALLSITE_HPP_
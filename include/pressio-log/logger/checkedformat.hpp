@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// checkedformat.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_CHECKEDFORMAT_HPP_
+#define PRESSIOLOG_LOGGER_CHECKEDFORMAT_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+#include <pressio-log/fmt/fmt.h>
+
+#include "frontend.hpp"
+#include "logger_templates.hpp"
+
+namespace pressiolog { namespace frontend {
+
+/*
+ * Format string of a logging macro with the given argument types, where
+ * core.hpp is included. fmt checks string literals against the arguments,
+ * format specifications included, at compile time (C++20, as for
+ * fmt::format); strings built at run time must be passed through
+ * fmt::runtime().
+ */
+template <typename... Args>
+class CheckedFormat {
+    public:
+        template <std::size_t N>
+        FMT_CONSTEVAL CheckedFormat(const char (&format)[N]) : format_(format), constant_(true) {}
+
+        // A character array that is not const may change between calls
+        template <std::size_t N>
+        CheckedFormat(char (&format)[N]) = delete;
+
+        CheckedFormat(fmt::runtime_format_string<char> format) : format_(format) {}
+
+        const utils::format_string<const Args&...>& get() const { return format_; }
+        // Whether this is a string literal (or another const character array)
+        bool isConstant() const { return constant_; }
+
+    private:
+        utils::format_string<const Args&...> format_;
+        bool constant_{false};
+};
+
+namespace detail {
+
+// Whether text is the source text of a single string literal without escape
+// sequences, whose characters are then the ones between its quotes
+constexpr bool isPlainLiteral(std::string_view text) {
+    if (text.size() < 2 or text.front() != '"' or text.back() != '"') {
+        return false;
+    }
+    return text.substr(1, text.size() - 2).find_first_of("\"\\") == std::string_view::npos;
+}
+
+// The literal format argument of a macro as one of fmt's compile-time
+// strings (see FMT_STRING), which fmt checks at compile time without consteval
+template <typename Spelling>
+struct SpelledFormat : fmt::detail::compile_string {
+    using char_type = char;
+    constexpr explicit operator fmt::string_view() const {
+        constexpr std::string_view text = Spelling::text();
+        return fmt::string_view(text.data() + 1, text.size() - 2);
+    }
+};
+
+} // end namespace detail
+
+// Preferred over the overloads of frontend.hpp (see there) wherever it is
+// visible. Messages without arguments are written as they are, like
+// Logger::log, so they still go through frontend.hpp. Once checked, packable
+// arguments are handed over as frontend.hpp does, which leaves the sinks to
+// the translation unit that initializes the Logger.
+template <typename Spelling, typename Arg, typename... Args>
+void logFromMacro(Typed<Spelling>, const Callsite& callsite, LogLevel level,
+                  CheckedFormat<detail::type_identity_t<Arg>, detail::type_identity_t<Args>...> format,
+                  const Arg& arg, const Args&... args) {
+    // With consteval, CheckedFormat has had fmt check the literal already
+    #if !defined(FMT_USE_CONSTEVAL) || !FMT_USE_CONSTEVAL
+    if constexpr (detail::isPlainLiteral(Spelling::text())) {
+        const utils::format_string<const Arg&, const Args&...> checked{detail::SpelledFormat<Spelling>()};
+        static_cast<void>(checked);
+    }
+    #endif
+    if constexpr (argpack::are_packable_v<Arg, Args...>) {
+        const fmt::string_view text = format.get().get();
+        detail::logPacked(callsite, level, std::string_view(text.data(), text.size()),
+                          format.isConstant(), arg, args...);
+    } else {
+        Logger::instance().logChecked(callsite, level, format.isConstant(), format.get(), arg, args...);
+    }
+}
+
+}} // end namespace pressiolog::frontend
+
+#endif // PRESSIOLOG_LOGGER_CHECKEDFORMAT_HPP_
@@ -49,27 +49,40 @@
 #ifndef PRESSIOLOG_LOGGER_COLORS_HPP_
 #define PRESSIOLOG_LOGGER_COLORS_HPP_
 
-#include <string>
+#include <string_view>
+
+#include "loglevel.hpp"
 
 namespace pressiolog { namespace colors {
 
-inline std::string color(std::string str, std::string color_code) {
-    #if PRESSIO_ENABLE_COLORIZED_OUTPUT
-    return "\033[" + color_code + "m" + str + "\033[0m";
-    #endif
-    return str;
-}
+// ANSI escape sequences
+inline constexpr std::string_view green  = "\033[32m";
+inline constexpr std::string_view red    = "\033[31m";
+inline constexpr std::string_view yellow = "\033[33m";
+inline constexpr std::string_view reset  = "\033[0m";
 
-inline std::string green(std::string str) {
-    return color(str, "32");
+// Returns the escape sequence when colorizing, and an empty string otherwise
+constexpr std::string_view when(bool colorize, std::string_view sequence) {
+    return colorize ? sequence : std::string_view();
 }
 
-inline std::string red(std::string str) {
-    return color(str, "31");
+// Returns the text that starts a message at the given level: "WARNING: " and
+// "ERROR: ", preceded by their color when colorizing. Other levels have none.
+constexpr std::string_view prefix(LogLevel level, bool colorize) {
+    switch (level) {
+        case LogLevel::warning:
+            return colorize ? "\033[33mWARNING: " : "WARNING: ";
+        case LogLevel::error:
+            return colorize ? "\033[31mERROR: " : "ERROR: ";
+        default:
+            return {};
+    }
 }
 
-inline std::string yellow(std::string str) {
-    return color(str, "33");
+// Returns the text that ends a message at the given level (the color reset)
+constexpr std::string_view suffix(LogLevel level, bool colorize) {
+    return colorize and (level == LogLevel::warning or level == LogLevel::error)
+        ? reset : std::string_view();
 }
 
 }} // end namespace pressiolog::colors
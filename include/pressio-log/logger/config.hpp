@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// config.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_CONFIG_HPP_
+#define PRESSIOLOG_LOGGER_CONFIG_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "loglevel.hpp"
+#include "logto.hpp"
+#include "fileformat.hpp"
+
+namespace pressiolog {
+
+/*
+ * The configuration every logging call reads, packed into a single word:
+ *
+ *     bits 0-7   logging level
+ *     bit  8     logger is initialized
+ *     bit  9     this rank is the logging rank
+ *     bit  10    write to the console
+ *     bit  11    write to the file
+ *     bit  12    the file is binary
+ *     bit  13    records are timestamped
+ *
+ * ConfigSnapshot is an immutable value; changes produce a new snapshot.
+ */
+class ConfigSnapshot {
+    public:
+        constexpr ConfigSnapshot() = default;
+        constexpr explicit ConfigSnapshot(std::uint64_t bits) : bits_(bits) {}
+
+        constexpr std::uint64_t bits() const { return bits_; }
+
+        constexpr LogLevel level() const { return static_cast<LogLevel>(bits_ & level_mask_); }
+        constexpr bool initialized() const { return bits_ & initialized_bit_; }
+        constexpr bool loggingRank() const { return bits_ & logging_rank_bit_; }
+        constexpr bool toConsole() const   { return bits_ & console_bit_; }
+        constexpr bool toFile() const      { return bits_ & file_bit_; }
+        constexpr bool binaryFile() const  { return bits_ & binary_bit_; }
+        constexpr bool timestamps() const  { return bits_ & timestamps_bit_; }
+
+        // The fields that decide whether a message is emitted, on which the
+        // cached thresholds of the callsites depend (see Callsite)
+        constexpr std::uint64_t filtering() const {
+            return bits_ & (level_mask_ | initialized_bit_ | logging_rank_bit_);
+        }
+
+        // Whether logging threads read the clock for each record
+        constexpr bool needsTime() const {
+            return timestamps() or (toFile() and binaryFile());
+        }
+
+        // Whether a message at the given level is emitted on this rank
+        constexpr bool enabled(LogLevel level) const {
+            return loggingRank() and level != LogLevel::none and this->level() >= level;
+        }
+
+        constexpr ConfigSnapshot withLevel(LogLevel level) const {
+            return ConfigSnapshot((bits_ & ~level_mask_) | static_cast<std::uint64_t>(level));
+        }
+        constexpr ConfigSnapshot withInitialized(bool value) const { return with_(initialized_bit_, value); }
+        constexpr ConfigSnapshot withLoggingRank(bool value) const { return with_(logging_rank_bit_, value); }
+        constexpr ConfigSnapshot withBinaryFile(bool value) const  { return with_(binary_bit_, value); }
+        constexpr ConfigSnapshot withTimestamps(bool value) const  { return with_(timestamps_bit_, value); }
+        constexpr ConfigSnapshot withDestination(LogTo destination) const {
+            return with_(console_bit_, destination == LogTo::console or destination == LogTo::both)
+                  .with_(file_bit_,    destination == LogTo::file    or destination == LogTo::both);
+        }
+
+    private:
+        constexpr ConfigSnapshot with_(std::uint64_t bit, bool value) const {
+            return ConfigSnapshot(value ? bits_ | bit : bits_ & ~bit);
+        }
+
+        static constexpr std::uint64_t level_mask_       = 0xff;
+        static constexpr std::uint64_t initialized_bit_  = 1u << 8;
+        static constexpr std::uint64_t logging_rank_bit_ = 1u << 9;
+        static constexpr std::uint64_t console_bit_      = 1u << 10;
+        static constexpr std::uint64_t file_bit_         = 1u << 11;
+        static constexpr std::uint64_t binary_bit_       = 1u << 12;
+        static constexpr std::uint64_t timestamps_bit_   = 1u << 13;
+
+        std::uint64_t bits_{0};
+};
+
+/*
+ * Holds the current ConfigSnapshot on its own cache line, so that logging
+ * threads read it with one load and setters never take a lock.
+ */
+class alignas(64) AtomicConfig {
+    public:
+        explicit AtomicConfig(ConfigSnapshot initial) : bits_(initial.bits()) {}
+
+        // Acquire, so that state published before initialization is visible
+        ConfigSnapshot load() const {
+            return ConfigSnapshot(bits_.load(std::memory_order_acquire));
+        }
+
+        // Applies change(ConfigSnapshot) -> ConfigSnapshot atomically, and
+        // returns the snapshot it replaced; concurrent updates of different
+        // fields are never lost
+        template <typename Change>
+        ConfigSnapshot update(Change&& change) {
+            std::uint64_t current = bits_.load(std::memory_order_relaxed);
+            while (!bits_.compare_exchange_weak(
+                       current, change(ConfigSnapshot(current)).bits(),
+                       std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            }
+            return ConfigSnapshot(current);
+        }
+
+    private:
+        std::atomic<std::uint64_t> bits_;
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_CONFIG_HPP_
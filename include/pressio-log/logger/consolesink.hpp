@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// consolesink.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_CONSOLESINK_HPP_
+#define PRESSIOLOG_LOGGER_CONSOLESINK_HPP_
+
+#include <cstdio>
+#include <iostream>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "loglevel.hpp"
+#include "logline.hpp"
+#include "flushpolicy.hpp"
+
+namespace pressiolog {
+
+/*
+ * Writes log records to std::cout without forcing a flush on every line.
+ *
+ * The rank and the level prefixes are colored when colors are enabled (see
+ * setColorize()), which the Logger does only when stdout is a terminal.
+ *
+ * By default, output is flushed after every message when stdout is a
+ * terminal, and left to the stream's block buffering otherwise (e.g. when
+ * stdout is redirected to a batch-system file), flushing only on errors.
+ *
+ * Not thread safe: the Logger serializes access.
+ */
+class ConsoleSink {
+    public:
+        ConsoleSink() : policy_(defaultFlushPolicy()) {}
+
+        // Line-buffered on a terminal, block-buffered (flushing on errors) otherwise
+        static FlushPolicy defaultFlushPolicy() {
+            FlushPolicy policy;
+            if (!stdoutIsTerminal()) {
+                policy.every_message = false;
+                policy.on_warning = false;
+            }
+            return policy;
+        }
+
+        static bool stdoutIsTerminal() {
+            #if defined(_WIN32)
+            return _isatty(_fileno(stdout)) != 0;
+            #else
+            return isatty(fileno(stdout)) != 0;
+            #endif
+        }
+
+        void setFlushPolicy(const FlushPolicy& policy) {
+            policy_ = policy;
+        }
+
+        void setColorize(bool colorize) {
+            colorize_ = colorize;
+        }
+
+        bool colorize() const {
+            return colorize_;
+        }
+
+        void write(const LogLine& line) {
+            const auto size = line.render(colorize_, [](std::string_view part) {
+                std::cout.write(part.data(), static_cast<std::streamsize>(part.size()));
+            });
+            std::cout.put('\n');
+            if (state_.recordWrite(policy_, line.level, size + 1)) {
+                flush();
+            }
+        }
+
+        void flush() {
+            std::cout.flush();
+            state_.flushed();
+        }
+
+    private:
+        FlushPolicy policy_;
+        FlushState state_;
+        bool colorize_{false};
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_CONSOLESINK_HPP_
@@ -0,0 +1,145 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// controlmacros.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_CONTROLMACROS_HPP_
+#define PRESSIOLOG_LOGGER_CONTROLMACROS_HPP_
+
+/*
+ * Macros that initialize, finalize, and configure the Logger. Only
+ * preprocessor definitions: the Logger comes from core.hpp or the
+ * pressio.log module.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialization/Finalization
+
+#if PRESSIO_ENABLE_TPL_MPI
+    #define PRESSIOLOG_INITIALIZE(...) \
+        pressiolog::Logger::instance().initializeWithMPI(__VA_ARGS__)
+#else
+    #define PRESSIOLOG_INITIALIZE(...) \
+        pressiolog::Logger::instance().initialize(__VA_ARGS__)
+#endif
+
+#define PRESSIOLOG_FINALIZE(...) \
+    pressiolog::Logger::instance().finalize(__VA_ARGS__)
+
+#define PRESSIOLOG_FLUSH(...) \
+    pressiolog::Logger::instance().flush(__VA_ARGS__)
+
+///////////////////////////////////////////////////////////////////////////////
+// Setters
+
+#define PRESSIOLOG_SET_LEVEL(...) \
+    pressiolog::Logger::instance().setLoggingLevel(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_OUTPUT_STREAM(...) \
+    pressiolog::Logger::instance().setOutputStream(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_OUTPUT_FILENAME(...) \
+    pressiolog::Logger::instance().setOutputFilename(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_FILE_FORMAT(...) \
+    pressiolog::Logger::instance().setFileFormat(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_TIMESTAMP_MODE(...) \
+    pressiolog::Logger::instance().setTimestampMode(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_CONSOLE_FLUSH_POLICY(...) \
+    pressiolog::Logger::instance().setConsoleFlushPolicy(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_FILE_FLUSH_POLICY(...) \
+    pressiolog::Logger::instance().setFileFlushPolicy(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_FILE_BUFFER_SIZE(...) \
+    pressiolog::Logger::instance().setFileBufferSize(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_ASYNC_QUEUE_CAPACITY(...) \
+    pressiolog::Logger::instance().setAsyncQueueCapacity(__VA_ARGS__)
+
+#define PRESSIOLOG_SET_OVERFLOW_POLICY(...) \
+    pressiolog::Logger::instance().setOverflowPolicy(__VA_ARGS__)
+
+#if PRESSIO_ENABLE_TPL_MPI
+
+    #define PRESSIOLOG_SET_LOGGING_RANK(...) \
+        pressiolog::Logger::instance().setLoggingRank(__VA_ARGS__)
+
+    #define PRESSIOLOG_SET_COMMUNICATOR(...) \
+        pressiolog::Logger::instance().setCommunicator(__VA_ARGS__)
+
+#endif // PRESSIO_ENABLE_TPL_MPI
+
+///////////////////////////////////////////////////////////////////////////////
+// Callsites
+
+#define PRESSIOLOG_CALLSITES() \
+    pressiolog::Logger::instance().callsites()
+
+#define PRESSIOLOG_SET_CALLSITE_STATE(...) \
+    pressiolog::Logger::instance().setCallsiteState(__VA_ARGS__)
+
+#define PRESSIOLOG_ENABLE_CALLSITES(...) \
+    pressiolog::Logger::instance().enableCallsites(__VA_ARGS__)
+
+#define PRESSIOLOG_DISABLE_CALLSITES(...) \
+    pressiolog::Logger::instance().disableCallsites(__VA_ARGS__)
+
+#define PRESSIOLOG_RESET_CALLSITES() \
+    pressiolog::Logger::instance().resetCallsites()
+
+///////////////////////////////////////////////////////////////////////////////
+// Channels
+
+#define PRESSIOLOG_SET_CHANNEL_LEVEL(...) \
+    pressiolog::Logger::instance().setChannelLevel(__VA_ARGS__)
+
+#define PRESSIOLOG_RESET_CHANNEL_LEVEL(...) \
+    pressiolog::Logger::instance().resetChannelLevel(__VA_ARGS__)
+
+#endif // PRESSIOLOG_LOGGER_CONTROLMACROS_HPP_
@@ -0,0 +1,226 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// environment.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_ENVIRONMENT_HPP_
+#define PRESSIOLOG_LOGGER_ENVIRONMENT_HPP_
+
+#include <cctype>
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "loglevel.hpp"
+#include "logmode.hpp"
+#include "logto.hpp"
+#include "timestampmode.hpp"
+
+namespace pressiolog { namespace env {
+
+/*
+ * Logger settings read from environment variables at initialization, so that
+ * the verbosity of a run can be changed without recompiling:
+ *
+ *     PRESSIOLOG_LEVEL       none, sparse, error, warning, info, debug (or 0-5)
+ *     PRESSIOLOG_DEST        console, file, both
+ *     PRESSIOLOG_FILE        name of the log file
+ *     PRESSIOLOG_RANK        logging rank (MPI builds only)
+ *     PRESSIOLOG_ASYNC       sync, async, deferred (or 0/1, off/on, false/true)
+ *     PRESSIOLOG_CHANNELS    channel levels, e.g. "solvers=debug,linalg=warning"
+ *     PRESSIOLOG_TIMESTAMPS  none, absolute, since_start, delta
+ *
+ * Values are case insensitive. A variable that is set (and not empty) overrides the
+ * corresponding PRESSIOLOG_INITIALIZE() argument; an invalid value throws.
+ */
+struct Settings {
+    std::optional<LogLevel> level;
+    std::optional<LogTo> destination;
+    std::optional<std::string> filename;
+    std::optional<int> logging_rank;
+    std::optional<LogMode> mode;
+    std::vector<std::pair<std::string, LogLevel>> channel_levels;
+    std::optional<TimestampMode> timestamps;
+};
+
+namespace detail {
+
+inline std::string lower(std::string_view value) {
+    std::string result(value);
+    for (auto& c : result) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return result;
+}
+
+inline std::string_view trim(std::string_view value) {
+    while (!value.empty() and std::isspace(static_cast<unsigned char>(value.front()))) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() and std::isspace(static_cast<unsigned char>(value.back()))) {
+        value.remove_suffix(1);
+    }
+    return value;
+}
+
+[[noreturn]] inline void invalid(const char* variable, std::string_view value, const char* expected) {
+    throw std::runtime_error(
+        std::string("Invalid value '") + std::string(value) + "' for " + variable
+        + " (expected " + expected + ")");
+}
+
+} // end namespace detail
+
+inline LogLevel parseLevel(std::string_view value, const char* variable = "PRESSIOLOG_LEVEL") {
+    const auto v = detail::lower(detail::trim(value));
+    if (v == "none"    or v == "0") return LogLevel::none;
+    if (v == "sparse"  or v == "1") return LogLevel::sparse;
+    if (v == "error"   or v == "2") return LogLevel::error;
+    if (v == "warning" or v == "3") return LogLevel::warning;
+    if (v == "info"    or v == "4") return LogLevel::info;
+    if (v == "debug"   or v == "5") return LogLevel::debug;
+    detail::invalid(variable, value, "none, sparse, error, warning, info, or debug");
+}
+
+inline LogTo parseDestination(std::string_view value) {
+    const auto v = detail::lower(detail::trim(value));
+    if (v == "console") return LogTo::console;
+    if (v == "file")    return LogTo::file;
+    if (v == "both")    return LogTo::both;
+    detail::invalid("PRESSIOLOG_DEST", value, "console, file, or both");
+}
+
+inline LogMode parseMode(std::string_view value) {
+    const auto v = detail::lower(detail::trim(value));
+    if (v == "sync"  or v == "0" or v == "off" or v == "false") return LogMode::sync;
+    if (v == "async" or v == "1" or v == "on"  or v == "true")  return LogMode::async;
+    if (v == "deferred") return LogMode::deferred;
+    detail::invalid("PRESSIOLOG_ASYNC", value, "sync, async, or deferred");
+}
+
+inline int parseRank(std::string_view value) {
+    const auto v = std::string(detail::trim(value));
+    std::size_t end = 0;
+    int rank = -1;
+    try {
+        rank = std::stoi(v, &end);
+    } catch (const std::logic_error&) {
+    }
+    if (rank < 0 or end != v.size()) {
+        detail::invalid("PRESSIOLOG_RANK", value, "a non-negative integer");
+    }
+    return rank;
+}
+
+inline TimestampMode parseTimestamps(std::string_view value) {
+    const auto v = detail::lower(detail::trim(value));
+    if (v == "none")        return TimestampMode::none;
+    if (v == "absolute")    return TimestampMode::absolute;
+    if (v == "since_start") return TimestampMode::since_start;
+    if (v == "delta")       return TimestampMode::delta;
+    detail::invalid("PRESSIOLOG_TIMESTAMPS", value, "none, absolute, since_start, or delta");
+}
+
+// Parses "channel=level,channel=level,..."
+inline std::vector<std::pair<std::string, LogLevel>> parseChannels(std::string_view value) {
+    std::vector<std::pair<std::string, LogLevel>> result;
+    while (!value.empty()) {
+        const auto comma = value.find(',');
+        const auto entry = detail::trim(value.substr(0, comma));
+        value = comma == std::string_view::npos ? std::string_view() : value.substr(comma + 1);
+        if (entry.empty()) {
+            continue;
+        }
+        const auto equals = entry.find('=');
+        const auto channel = detail::trim(entry.substr(0, equals));
+        if (equals == std::string_view::npos or channel.empty()) {
+            detail::invalid("PRESSIOLOG_CHANNELS", entry, "channel=level");
+        }
+        result.emplace_back(std::string(channel),
+                            parseLevel(entry.substr(equals + 1), "PRESSIOLOG_CHANNELS"));
+    }
+    return result;
+}
+
+// Variables that are unset or empty are ignored
+inline const char* get(const char* variable) {
+    const char* value = std::getenv(variable);
+    return value and *value ? value : nullptr;
+}
+
+inline Settings read() {
+    Settings settings;
+    if (const char* value = get("PRESSIOLOG_LEVEL")) {
+        settings.level = parseLevel(value);
+    }
+    if (const char* value = get("PRESSIOLOG_DEST")) {
+        settings.destination = parseDestination(value);
+    }
+    if (const char* value = get("PRESSIOLOG_FILE")) {
+        settings.filename = std::string(value);
+    }
+    if (const char* value = get("PRESSIOLOG_RANK")) {
+        settings.logging_rank = parseRank(value);
+    }
+    if (const char* value = get("PRESSIOLOG_ASYNC")) {
+        settings.mode = parseMode(value);
+    }
+    if (const char* value = get("PRESSIOLOG_CHANNELS")) {
+        settings.channel_levels = parseChannels(value);
+    }
+    if (const char* value = get("PRESSIOLOG_TIMESTAMPS")) {
+        settings.timestamps = parseTimestamps(value);
+    }
+    return settings;
+}
+
+}} // end namespace pressiolog::env
+
+#endif // PRESSIOLOG_LOGGER_ENVIRONMENT_HPP_
@@ -0,0 +1,186 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// filesink.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_FILESINK_HPP_
+#define PRESSIOLOG_LOGGER_FILESINK_HPP_
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "loglevel.hpp"
+#include "logline.hpp"
+#include "flushpolicy.hpp"
+
+namespace pressiolog {
+
+/*
+ * Appends log records to a file that stays open between messages.
+ *
+ * The file is opened on the first write and kept open until close() (called
+ * from PRESSIOLOG_FINALIZE()) or until the path changes. Output goes through
+ * a user-sized buffer and is flushed according to the FlushPolicy: by
+ * default on errors, every 64 KiB and at least once per second (checked when
+ * a message is written), rather than after every message, which would cost
+ * a system call per record. Records are written as plain text, without colors.
+ *
+ * Not thread safe: the Logger serializes access.
+ */
+class FileSink {
+    public:
+        FileSink() : policy_(defaultFlushPolicy()) {}
+        FileSink(const FileSink&) = delete;
+        FileSink& operator=(const FileSink&) = delete;
+
+        ~FileSink() {
+            close();
+        }
+
+        const std::string& path() const {
+            return path_;
+        }
+
+        // Changes the output file (the current one is closed if the path differs)
+        void setPath(const std::string& path) {
+            if (path != path_) {
+                close();
+                path_ = path;
+            }
+        }
+
+        // Block-buffered, flushing on errors and by size or interval
+        static FlushPolicy defaultFlushPolicy() {
+            FlushPolicy policy = FlushPolicy::buffered();
+            policy.on_warning = false;
+            return policy;
+        }
+
+        void setFlushPolicy(const FlushPolicy& policy) {
+            policy_ = policy;
+        }
+
+        // Opens the file in binary mode (the current one is closed if this changes)
+        void setBinary(bool binary) {
+            if (binary != binary_) {
+                close();
+                binary_ = binary;
+            }
+        }
+
+        bool isOpen() const {
+            return file_.is_open();
+        }
+
+        // Size of the write buffer (takes effect the next time the file is opened)
+        void setBufferSize(std::size_t size) {
+            buffer_size_ = size;
+        }
+
+        void write(const LogLine& line) {
+            if (!file_.is_open()) {
+                open_();
+            }
+            const auto size = line.render(false, [this](std::string_view part) {
+                file_.write(part.data(), static_cast<std::streamsize>(part.size()));
+            });
+            file_.put('\n');
+            if (state_.recordWrite(policy_, line.level, size + 1)) {
+                flush();
+            }
+        }
+
+        // Writes the bytes as they are, without a line break
+        void writeBytes(LogLevel level, std::string_view bytes) {
+            if (!file_.is_open()) {
+                open_();
+            }
+            file_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            if (state_.recordWrite(policy_, level, bytes.size())) {
+                flush();
+            }
+        }
+
+        void flush() {
+            if (file_.is_open()) {
+                file_.flush();
+            }
+            state_.flushed();
+        }
+
+        void close() {
+            if (file_.is_open()) {
+                file_.close();
+            }
+            state_.flushed();
+        }
+
+    private:
+        void open_() {
+            // The buffer must be installed before the file is opened
+            buffer_.resize(buffer_size_);
+            file_.rdbuf()->pubsetbuf(
+                buffer_.empty() ? nullptr : buffer_.data(),
+                static_cast<std::streamsize>(buffer_.size()));
+            file_.open(path_, binary_ ? std::ios::app | std::ios::binary : std::ios::app);
+            state_.flushed();
+        }
+
+        std::string path_{"pressio.log"};
+        std::size_t buffer_size_{64 * 1024};
+        bool binary_{false};
+        FlushPolicy policy_;
+        FlushState state_;
+        // Declared before file_ so it outlives the stream using it
+        std::vector<char> buffer_;
+        std::ofstream file_;
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_FILESINK_HPP_
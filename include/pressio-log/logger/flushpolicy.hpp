@@ -0,0 +1,128 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// flushpolicy.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_FLUSHPOLICY_HPP_
+#define PRESSIOLOG_LOGGER_FLUSHPOLICY_HPP_
+
+#include <chrono>
+#include <cstddef>
+
+#include "loglevel.hpp"
+
+namespace pressiolog {
+
+/*
+ * Determines when a sink hands its buffered output to the operating system.
+ *
+ * A flush happens as soon as any of the enabled conditions is met. Byte and
+ * time limits are checked whenever a message is written, so output is never
+ * held back longer than until the next message (or PRESSIOLOG_FLUSH() /
+ * PRESSIOLOG_FINALIZE()). A default FlushPolicy flushes after every message,
+ * which suits a terminal; files default to FileSink::defaultFlushPolicy().
+ */
+struct FlushPolicy {
+    // Flush after every message
+    bool every_message{true};
+
+    // Flush after every warning or error
+    bool on_warning{true};
+    bool on_error{true};
+
+    // Flush once this many bytes have been written since the last flush (0 disables)
+    std::size_t every_bytes{0};
+
+    // Flush once this much time has passed since the last flush (0 disables)
+    std::chrono::milliseconds every{0};
+
+    // Only flush on warnings, errors, and the given byte/time limits
+    static FlushPolicy buffered(
+        std::size_t bytes = 64 * 1024,
+        std::chrono::milliseconds interval = std::chrono::milliseconds(1000)
+    ) {
+        FlushPolicy policy;
+        policy.every_message = false;
+        policy.every_bytes = bytes;
+        policy.every = interval;
+        return policy;
+    }
+};
+
+// Tracks the output written since the last flush against a FlushPolicy
+class FlushState {
+    public:
+        // Records a write of the given size and returns whether to flush now
+        bool recordWrite(const FlushPolicy& policy, LogLevel level, std::size_t bytes) {
+            pending_bytes_ += bytes;
+            if (policy.every_message
+                or (policy.on_warning and level == LogLevel::warning)
+                or (policy.on_error   and level == LogLevel::error)
+                or (policy.every_bytes > 0 and pending_bytes_ >= policy.every_bytes)) {
+                return true;
+            }
+            return policy.every.count() > 0
+               and std::chrono::steady_clock::now() - last_flush_ >= policy.every;
+        }
+
+        // Resets the state after the sink has flushed
+        void flushed() {
+            pending_bytes_ = 0;
+            last_flush_ = std::chrono::steady_clock::now();
+        }
+
+        std::size_t pendingBytes() const {
+            return pending_bytes_;
+        }
+
+    private:
+        std::size_t pending_bytes_{0};
+        std::chrono::steady_clock::time_point last_flush_{std::chrono::steady_clock::now()};
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_FLUSHPOLICY_HPP_
@@ -0,0 +1,106 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// formatters.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_FORMATTERS_HPP_
+#define PRESSIOLOG_LOGGER_FORMATTERS_HPP_
+
+#include <pressio-log/fmt/fmt.h>
+
+#include "loglevel.hpp"
+#include "logto.hpp"
+#include "logmode.hpp"
+#include "fileformat.hpp"
+#include "timestampmode.hpp"
+#include "overflowpolicy.hpp"
+#include "callsite.hpp"
+
+namespace pressiolog { namespace detail {
+
+// Formats an enum by its name (see toString()), accepting the same format
+// specifications as a string, e.g. "{:>8}"
+template <typename Enum>
+struct EnumFormatter : fmt::formatter<fmt::string_view> {
+    template <typename FormatContext>
+    auto format(Enum value, FormatContext& ctx) const {
+        const std::string_view name = toString(value);
+        return fmt::formatter<fmt::string_view>::format(
+            fmt::string_view(name.data(), name.size()), ctx);
+    }
+};
+
+}} // end namespace pressiolog::detail
+
+template <>
+struct fmt::formatter<pressiolog::LogLevel>
+    : pressiolog::detail::EnumFormatter<pressiolog::LogLevel> {};
+
+template <>
+struct fmt::formatter<pressiolog::LogTo>
+    : pressiolog::detail::EnumFormatter<pressiolog::LogTo> {};
+
+template <>
+struct fmt::formatter<pressiolog::LogMode>
+    : pressiolog::detail::EnumFormatter<pressiolog::LogMode> {};
+
+template <>
+struct fmt::formatter<pressiolog::FileFormat>
+    : pressiolog::detail::EnumFormatter<pressiolog::FileFormat> {};
+
+template <>
+struct fmt::formatter<pressiolog::TimestampMode>
+    : pressiolog::detail::EnumFormatter<pressiolog::TimestampMode> {};
+
+template <>
+struct fmt::formatter<pressiolog::OnOverflow>
+    : pressiolog::detail::EnumFormatter<pressiolog::OnOverflow> {};
+
+template <>
+struct fmt::formatter<pressiolog::CallsiteState>
+    : pressiolog::detail::EnumFormatter<pressiolog::CallsiteState> {};
+
+#endif // PRESSIOLOG_LOGGER_FORMATTERS_HPP_
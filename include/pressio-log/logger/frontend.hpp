@@ -0,0 +1,353 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// frontend.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_FRONTEND_HPP_
+#define PRESSIOLOG_LOGGER_FRONTEND_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "loglevel.hpp"
+#include "argpack.hpp"
+
+// Literal format strings are checked at compile time when consteval is available
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+    #define PRESSIOLOG_CONSTEVAL consteval
+    #define PRESSIOLOG_CHECK_FORMAT 1
+#else
+    #define PRESSIOLOG_CONSTEVAL constexpr
+    #define PRESSIOLOG_CHECK_FORMAT 0
+#endif
+
+namespace pressiolog {
+
+class Callsite;
+class Logger;
+
+namespace frontend {
+
+/*
+ * The entry point of the logging macros.
+ *
+ * Every macro expands to an unqualified call logFromMacro(Typed<...>{}, ...).
+ * Argument-dependent lookup finds the overloads visible where the call is
+ * instantiated, so a template that logs from a header that only includes
+ * macros.hpp uses the same overload in every translation unit of a program
+ * that includes core.hpp:
+ *
+ * - The overloads below, which take Erased, are always available. Arguments
+ *   that can be packed (numbers, strings, and pointers; see argpack.hpp) are
+ *   handed to the Logger through the entry points below, so translation units
+ *   that only include macros.hpp need neither the Logger nor fmt. Other
+ *   arguments are formatted by the Logger itself, which must then be defined
+ *   where the call is instantiated (see logFormatted() below).
+ * - Translation units that include core.hpp also see the overload of
+ *   checkedformat.hpp, which takes Typed and is preferred. Its format string
+ *   is checked by fmt; the arguments are then handed over the same way.
+ *
+ * Both write the same message: a non-template function of a header that
+ * only includes macros.hpp uses the overloads below if the header comes
+ * before core.hpp, which only changes how its format strings are checked.
+ *
+ * The Logger installs the entry points when it is initialized, so that a
+ * translation unit only compiles the Logger's implementation if it uses it.
+ * Until then, messages are dropped (see warnUninitialized()).
+ */
+struct EntryPoints {
+    // Registers the callsite and returns whether the message is emitted
+    bool (*register_callsite)(Callsite& callsite, LogLevel level);
+    // Logs a message without arguments (as is, like Logger::log)
+    void (*log_message)(const Callsite& callsite, LogLevel level, std::string_view message);
+    // Logs a format string and arguments packed by argpack::packAll. A
+    // constant format string is the same on every call from the callsite.
+    void (*log_packed)(const Callsite& callsite, LogLevel level, std::string_view format,
+                       bool constant_format, std::string_view packed);
+};
+
+inline EntryPoints entry_points{nullptr, nullptr, nullptr};
+
+// Warns, once, that a message was dropped because the Logger has not been
+// initialized. Written to stdout directly, as the console sink is the Logger's.
+inline void warnUninitialized() {
+    static std::atomic<bool> warned{false};
+    if (!warned.load(std::memory_order_relaxed)
+        and !warned.exchange(true, std::memory_order_relaxed)) {
+        std::fputs("WARNING: You are trying to use pressio-log, but it has not been initialized. "
+                   "Initialize with PRESSIOLOG_INITIALIZE().\n", stdout);
+        std::fflush(stdout);
+    }
+}
+
+// Overload tags of logFromMacro(): the macros pass Typed, so the overload
+// that takes it is preferred when it is visible. Spelling::text() is the
+// source text of the macro's format argument.
+struct Erased {};
+
+template <typename Spelling>
+struct Typed : Erased {};
+
+namespace detail {
+
+template <typename T>
+struct type_identity { using type = T; };
+
+template <typename T>
+using type_identity_t = typename type_identity<T>::type;
+
+// Not constexpr, so that reaching it while checking a format string at
+// compile time is an error that shows the reason
+inline void invalidFormat(const char*) {}
+
+/*
+ * Compile-time check of a format string against the number of its
+ * arguments: braces must match, and every replacement field (including
+ * nested ones, for a dynamic width or precision) must refer to an argument.
+ * The format specifications themselves are checked by fmt when the message
+ * is formatted.
+ */
+class FormatChecker {
+    public:
+        constexpr FormatChecker(std::string_view format, std::size_t num_args)
+            : format_(format), num_args_(num_args) {}
+
+        constexpr void check() {
+            while (pos_ < format_.size()) {
+                const char c = format_[pos_++];
+                if (c == '{') {
+                    if (peek_('{')) {
+                        ++pos_;
+                    } else {
+                        field_();
+                    }
+                } else if (c == '}') {
+                    if (!peek_('}')) {
+                        invalidFormat("unmatched '}' in format string");
+                    }
+                    ++pos_;
+                }
+            }
+        }
+
+    private:
+        constexpr bool peek_(char c) const {
+            return pos_ < format_.size() and format_[pos_] == c;
+        }
+
+        static constexpr bool isDigit_(char c) { return c >= '0' and c <= '9'; }
+        static constexpr bool isNameStart_(char c) {
+            return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or c == '_';
+        }
+
+        // A replacement field after its '{': [arg_id][:spec]}
+        constexpr void field_() {
+            argId_();
+            if (peek_(':')) {
+                ++pos_;
+                while (pos_ < format_.size() and format_[pos_] != '}') {
+                    if (format_[pos_++] == '{') {
+                        argId_();
+                        if (!peek_('}')) {
+                            invalidFormat("invalid dynamic width or precision");
+                        }
+                        ++pos_;
+                    }
+                }
+            }
+            if (!peek_('}')) {
+                invalidFormat("unmatched '{' in format string");
+            }
+            ++pos_;
+        }
+
+        constexpr void argId_() {
+            std::size_t index = 0;
+            if (pos_ < format_.size() and isDigit_(format_[pos_])) {
+                while (pos_ < format_.size() and isDigit_(format_[pos_])) {
+                    index = index * 10 + static_cast<std::size_t>(format_[pos_++] - '0');
+                }
+                manual_ = true;
+            } else if (pos_ < format_.size() and isNameStart_(format_[pos_])) {
+                // Named arguments (fmt::arg) are matched when formatting
+                while (pos_ < format_.size() and (isNameStart_(format_[pos_]) or isDigit_(format_[pos_]))) {
+                    ++pos_;
+                }
+                return;
+            } else {
+                index = next_++;
+                automatic_ = true;
+            }
+            if (automatic_ and manual_) {
+                invalidFormat("cannot switch between automatic and manual argument indexing");
+            }
+            if (index >= num_args_) {
+                invalidFormat("argument not found");
+            }
+        }
+
+        std::string_view format_;
+        std::size_t num_args_;
+        std::size_t pos_{0};
+        std::size_t next_{0};
+        bool automatic_{false};
+        bool manual_{false};
+};
+
+template <typename T, typename = void>
+inline constexpr bool is_runtime_format_v = false;
+
+// fmt::runtime() returns a wrapper whose str member holds the format string
+template <typename T>
+inline constexpr bool is_runtime_format_v<T, std::void_t<decltype(std::declval<const T&>().str)>> = true;
+
+template <typename T, typename = void>
+inline constexpr bool is_complete_v = false;
+
+template <typename T>
+inline constexpr bool is_complete_v<T, std::void_t<decltype(sizeof(T))>> = true;
+
+// Names T in a way that depends on Args, so that it is only looked at on instantiation
+template <typename T, typename... Args>
+struct Dependent { using type = T; };
+
+} // end namespace detail
+
+/*
+ * Format string of a logging macro with the given argument types, where
+ * core.hpp is not included. String literals are checked against the
+ * arguments at compile time (C++20); strings built at run time must be
+ * passed through fmt::runtime(), and are checked when the message is
+ * formatted.
+ */
+template <typename... Args>
+class FormatString {
+    public:
+        template <std::size_t N>
+        PRESSIOLOG_CONSTEVAL FormatString(const char (&format)[N]) : str_(format), constant_(true) {
+            #if PRESSIOLOG_CHECK_FORMAT
+            detail::FormatChecker(str_, sizeof...(Args)).check();
+            #endif
+        }
+
+        // A character array that is not const may change between calls
+        template <std::size_t N>
+        FormatString(char (&format)[N]) = delete;
+
+        template <typename Runtime, typename = std::enable_if_t<detail::is_runtime_format_v<Runtime>>>
+        FormatString(const Runtime& format) : str_(format.str.data(), format.str.size()) {}
+
+        std::string_view view() const { return str_; }
+        // Whether this is a string literal (or another const character array)
+        bool isConstant() const { return constant_; }
+
+    private:
+        std::string_view str_;
+        bool constant_{false};
+};
+
+// Reused by the packed messages of each thread
+inline std::string& packBuffer() {
+    thread_local std::string buffer;
+    return buffer;
+}
+
+namespace detail {
+
+/*
+ * Formats the arguments with the Logger, so that fmt's formatters (and the
+ * ones pressio-log adds, e.g. for LogLevel or pressiolog::range) apply.
+ *
+ * The Logger is named through Dependent, so it only has to be defined where
+ * this is instantiated rather than where the macro is written: a template
+ * in a header that only includes macros.hpp may log any type, as long as
+ * core.hpp is included before the template is used.
+ */
+template <typename... Args>
+void logFormatted(const Callsite& callsite, LogLevel level, const FormatString<Args...>& format,
+                  const Args&... args) {
+    using LoggerType = typename Dependent<Logger, Args...>::type;
+    static_assert(is_complete_v<LoggerType>,
+                  "without the Logger, the logging macros can only log numbers, strings, and pointers "
+                  "(at most 16 arguments): include <pressio-log/core.hpp> to log other types");
+    LoggerType::instance().logFormatted(callsite, level, format.view(), format.isConstant(), args...);
+}
+
+// Hands arguments that can be packed to the Logger through the entry points
+template <typename... Args>
+void logPacked(const Callsite& callsite, LogLevel level, std::string_view format,
+               bool constant_format, const Args&... args) {
+    auto& packed = packBuffer();
+    packed.clear();
+    argpack::packAll(packed, args...);
+    entry_points.log_packed(callsite, level, format, constant_format, packed);
+}
+
+} // end namespace detail
+
+inline void logFromMacro(Erased, const Callsite& callsite, LogLevel level, std::string_view message) {
+    entry_points.log_message(callsite, level, message);
+}
+
+template <typename... Args>
+void logFromMacro(Erased, const Callsite& callsite, LogLevel level,
+                  FormatString<detail::type_identity_t<Args>...> format, const Args&... args) {
+    if constexpr (argpack::are_packable_v<Args...>) {
+        detail::logPacked(callsite, level, format.view(), format.isConstant(), args...);
+    } else {
+        detail::logFormatted(callsite, level, format, args...);
+    }
+}
+
+} // end namespace frontend
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_FRONTEND_HPP_
@@ -50,42 +50,85 @@
 #define PRESSIOLOG_LOGGER_LOGGER_HPP_
 
 #include <mutex>
+#include <array>
 #include <atomic>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <pressio-log/fmt/fmt.h>
 #if PRESSIO_ENABLE_TPL_MPI
 #include <mpi.h>
 #endif
 
+// Only what the logging calls need: the sinks, the asynchronous queue and
+// the rest of the implementation are included by logger_impl.hpp
 #include "loglevel.hpp"
+#include "config.hpp"
+#include "callsite.hpp"
+#include "logmode.hpp"
 #include "logto.hpp"
+#include "fileformat.hpp"
+#include "timestampmode.hpp"
+#include "utils.hpp"
+#include "colors.hpp"
+#include "flushpolicy.hpp"
+#include "overflowpolicy.hpp"
+
+// Linkage of the Logger's out-of-class member functions (see logger_impl.hpp)
+#if PRESSIOLOG_COMPILED
+    #define PRESSIOLOG_INLINE
+#else
+    #define PRESSIOLOG_INLINE inline
+#endif
 
 namespace pressiolog {
 
+struct LogLine;
+template <typename Record>
+class AsyncQueue;
+
 class Logger {
     public:
         /*
-         * Returns a shared pointer to the singleton instance of PressioLogger.
+         * Returns a reference to the singleton instance of PressioLogger.
          *
-         * The static variable `instance` is initialized only once (when it is first accessed).
+         * The static variable `logger` is initialized only once (when it is first accessed).
          * Since C++11, the initialization of "magic statics" is guaranteed to be thread safe.
          *
          * For more info on "magic statics":
          *     https://blog.mbedded.ninja/programming/languages/c-plus-plus/magic-statics/
+         *
+         * This is the accessor used by the logging macros: unlike PressioLogger(),
+         * it does not touch a reference count, so concurrent logging threads do
+         * not contend on a shared control block.
+         */
+        static Logger& instance() {
+            static Logger logger;
+            return logger;
+        }
+
+        /*
+         * Returns a shared pointer to the singleton instance of PressioLogger.
+         *
+         * The pointer does not own the instance (which lives until program exit).
+         * Prefer instance() in performance-sensitive code.
          */
         static std::shared_ptr<Logger> PressioLogger() {
-            static std::shared_ptr<Logger> instance(new Logger());
-            return instance;
+            static std::shared_ptr<Logger> shared_instance(&instance(), [](Logger*) {});
+            return shared_instance;
         }
 
-        // Initialization and finalization
+        // Initialization and finalization. Environment variables override the
+        // arguments (see environment.hpp)
         void initialize(
             LogLevel level = LogLevel::sparse,
             LogTo destination = LogTo::console,
-            const std::string& filename = "pressio.log"
+            const std::string& filename = "pressio.log",
+            LogMode mode = LogMode::sync
         );
         #if PRESSIO_ENABLE_TPL_MPI
         void initializeWithMPI(
@@ -93,28 +136,83 @@ class Logger {
             LogTo destination = LogTo::console,
             const std::string& filename = "pressio.log",
             int logging_rank = 0,
-            MPI_Comm comm = MPI_COMM_WORLD
+            MPI_Comm comm = MPI_COMM_WORLD,
+            LogMode mode = LogMode::sync
         );
         #endif
         void finalize();
 
+        // Hands any buffered output to the operating system
+        void flush();
+
+        // Returns whether a message at the given level would be emitted on
+        // this rank. Used by the logging macros to skip argument evaluation
+        // and formatting for filtered messages.
+        bool isEnabled(LogLevel level) const;
+
+        // Number of records at the given level dropped because the
+        // asynchronous queue was full (since the last finalize())
+        std::size_t droppedRecords(LogLevel level) const;
+
         // Public logging functions
-        void log(LogLevel level, const std::string& message);
+        void log(LogLevel level, std::string_view message);
+        template <typename... Args>
+        void log(LogLevel level, utils::format_string<Args...> fmt_str, Args&&... args);
+        // Used by the logging macros, whose callsite has already checked the level
+        void log(const Callsite& callsite, LogLevel level, std::string_view message);
+        // Used by the logging macros for arguments they cannot pack, where
+        // core.hpp is not included (see frontend.hpp). A constant format
+        // string is the same on every call from the callsite.
         template <typename... Args>
-        void log(LogLevel level, const std::string& fmt_str, Args&&... args);
+        void logFormatted(const Callsite& callsite, LogLevel level, std::string_view fmt_str,
+                          bool constant_format, const Args&... args);
+        // Used by the logging macros where core.hpp is included (see checkedformat.hpp)
+        template <typename... Args>
+        void logChecked(const Callsite& callsite, LogLevel level, bool constant_format,
+                        utils::format_string<const Args&...> fmt_str, const Args&... args);
+
+        // Callsites of the logging macros that have run so far, by id
+        std::vector<CallsiteInfo> callsites() const;
+        // Overrides the logging level for one callsite (returns false for an unknown id)
+        bool setCallsiteState(std::size_t id, CallsiteState state);
+        // Enable or disable every callsite whose file, function, or "file:line"
+        // matches the pattern ('*' and '?' wildcards), including callsites that
+        // first run later. Returns the number of callsites matched so far.
+        std::size_t enableCallsites(const std::string& pattern);
+        std::size_t disableCallsites(const std::string& pattern);
+        // Makes every callsite follow the logging level again
+        void resetCallsites();
+
+        // Channels are dot-separated names (e.g. "solvers.newton") that group
+        // messages. A channel without a level of its own uses the level of its
+        // closest parent that has one, and otherwise the logging level.
+        void setChannelLevel(const std::string& channel, LogLevel level);
+        // Makes the channel inherit its level again
+        void resetChannelLevel(const std::string& channel);
+        LogLevel channelLevel(std::string_view channel) const;
 
         // Public setters
         void setLoggingLevel(LogLevel level);
         void setOutputStream(LogTo destination);
         void setOutputFilename(const std::string& log_file_name);
+        void setFileFormat(FileFormat format);
+        void setTimestampMode(TimestampMode mode);
+        void setConsoleFlushPolicy(const FlushPolicy& policy);
+        void setFileFlushPolicy(const FlushPolicy& policy);
+        void setFileBufferSize(std::size_t size);
+        // Number of records the asynchronous queue holds (set before initializing)
+        void setAsyncQueueCapacity(std::size_t capacity);
+        // What happens when the asynchronous queue is full (set before initializing)
+        void setOverflowPolicy(const OverflowPolicy& policy);
         #if PRESSIO_ENABLE_TPL_MPI
         void setLoggingRank(int rank);
         void setCommunicator(MPI_Comm comm);
         #endif
 
     private:
-        // Private constructor
+        // Private constructor and destructor
         Logger();
+        ~Logger();
 
         // Delete copy and move constructors
         Logger(const Logger&) = delete;
@@ -131,25 +229,63 @@ class Logger {
         #endif
 
         // Private setters
-        void setInitialized_();
-        void setDestinationBools_();
+        template <typename Change>
+        void updateConfig_(Change&& change);
+        void updateLoggingRank_();
+
+        // Filtering
+        static bool isEnabled_(ConfigSnapshot config, LogLevel level, bool level_checked = false);
+        bool shouldLog_(ConfigSnapshot config, LogLevel level, bool level_checked);
+
+        // Callsites
+        friend class Callsite;
+        void registerCallsite_(Callsite& callsite);
+        std::size_t addCallsiteRule_(const std::string& pattern, CallsiteState state);
+        void refreshCallsite_(Callsite& callsite, ConfigSnapshot config);
+        void refreshCallsites_();
+        LogLevel resolveChannelLevel_(std::string_view channel, LogLevel level) const;
+
+        // Entry points of the lightweight macros (see frontend.hpp)
+        static void installFrontend_();
 
         // Formatting
         void formatRankString_();
-        std::string formatWarning_(const std::string& message) const;
-        std::string formatError_(const std::string& message) const;
+        void formatTimestamp_(fmt::memory_buffer& buffer, std::uint64_t ticks);
 
-        // Internal logging functions
-        void sparse_(const std::string& message);
-        void info_(const std::string& message);
-        void debug_(const std::string& message);
-        void warning_(const std::string& message);
-        void error_(const std::string& message);
+        // Asynchronous logging
+        void startAsync_(LogMode mode);
+        void stopAsync_();
+        void drainAsync_();
+        void wakeAsync_();
+        void asyncWorker_();
+        struct AsyncRecord;
+        template <typename Fill>
+        void enqueue_(LogLevel level, const Fill& fill);
+        void writeRecord_(AsyncRecord& record);
+        void reportDropped_();
 
         // Output functions
-        void log_(const std::string& message);
-        void print_(const std::string& message);
-        void write_(const std::string& message);
+        void warnUninitialized_();
+        template <typename... Args>
+        void logFormatted_(ConfigSnapshot config, LogLevel level, std::size_t callsite_id,
+                           utils::format_string<Args...> fmt_str, Args&&... args);
+        void log_(ConfigSnapshot config, LogLevel level, std::string_view message);
+        template <typename... Args>
+        void logPacked_(ConfigSnapshot config, LogLevel level, std::size_t callsite_id,
+                        std::string_view fmt_str, const Args&... args);
+        void logPrepacked_(ConfigSnapshot config, LogLevel level, std::size_t callsite_id,
+                           std::string_view fmt_str, std::string_view packed);
+        void startPackedRecord_(AsyncRecord& record, ConfigSnapshot config, LogLevel level,
+                                std::uint64_t ticks, std::size_t callsite_id,
+                                std::string_view fmt_str);
+        void writeSinks_(bool to_console, bool to_file, LogLevel level, std::uint64_t ticks,
+                         std::string_view message);
+        void writePacked_(bool to_console, bool to_file, LogLevel level, std::uint64_t ticks,
+                          std::size_t callsite_id, std::string_view fmt_str,
+                          std::string_view packed);
+        void beginBinaryRecord_();
+        void print_(const LogLine& line);
+        void write_(const LogLine& line);
 
         ///////////////////////////////////////////////////////////////////////
         // Member variables
@@ -160,19 +296,40 @@ class Logger {
         std::string rank_str_;
 
         // Initialization
-        std::atomic<bool> logger_is_initialized_{false};
         std::once_flag init_flag_;
-        std::once_flag init_warning_flag_;
 
-        // Configuration
-        LogLevel logging_level_{LogLevel::none};
+        // Configuration read by logging threads (level, destination,
+        // initialization, ...); see config.hpp
+        AtomicConfig config_{
+            ConfigSnapshot().withLoggingRank(true).withDestination(LogTo::console)};
         int logging_rank_{0};
 
-        // Output
-        LogTo dst_{LogTo::console};
-        bool should_write_{false};
-        bool should_log_{true};
-        std::string log_file_{"pressio.log"};
+        // Callsites, as an intrusive list of their static descriptors (newest
+        // first), and the patterns given to enableCallsites()/disableCallsites()
+        mutable std::mutex callsite_mutex_;
+        Callsite* callsites_{nullptr};
+        std::size_t callsite_count_{0};
+        std::vector<std::pair<std::string, CallsiteState>> callsite_rules_;
+        // Output (the sinks, timestamps, channel levels and worker thread),
+        // defined in logger_impl.hpp so that this header stays light
+        struct Backend;
+        std::unique_ptr<Backend> backend_;
+        TimestampMode timestamp_mode_{TimestampMode::none};
+
+        // Asynchronous logging
+        std::atomic<bool> async_enabled_{false};
+        // Written once before async_enabled_ is set; read only after it is seen set
+        bool deferred_enabled_{false};
+        std::atomic<bool> async_stop_{false};
+        // Set while the worker waits for records (see wakeAsync_())
+        std::atomic<bool> async_parked_{false};
+        std::atomic<std::size_t> async_processed_{0};
+        // Records removed by producers under OnOverflow::drop_oldest
+        std::atomic<std::size_t> async_evicted_{0};
+        std::array<std::atomic<std::size_t>, 6> async_dropped_{};
+        OverflowPolicy overflow_policy_;
+        std::size_t async_queue_capacity_{8192};
+        std::unique_ptr<AsyncQueue<AsyncRecord>> async_queue_;
 
         // MPI
         #if PRESSIO_ENABLE_TPL_MPI
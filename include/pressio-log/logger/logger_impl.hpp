@@ -49,36 +49,117 @@
 #ifndef PRESSIOLOG_LOGGER_LOGGER_IMPL_HPP_
 #define PRESSIOLOG_LOGGER_LOGGER_IMPL_HPP_
 
-#include <fstream>
+#include <condition_variable>
 #include <iostream>
+#include <map>
+#include <stdexcept>
+#include <thread>
 
 #include "utils.hpp"
+#include "buffer.hpp"
 #include "colors.hpp"
+#include "argformat.hpp"
+#include "argpack.hpp"
+#include "tickclock.hpp"
+#include "timestamptext.hpp"
+#include "environment.hpp"
+#include "binarylog.hpp"
+#include "asyncqueue.hpp"
+#include "logline.hpp"
+#include "consolesink.hpp"
+#include "filesink.hpp"
 #include "logger.hpp"
+#include "logger_templates.hpp"
+
+/*
+ * Non-template member functions of the Logger. In the header-only build they
+ * are inline and compiled in every translation unit; in the compiled build
+ * (PRESSIOLOG_COMPILED) they are compiled once, into src/pressio-log.cc.
+ */
 
 namespace pressiolog {
 
+struct Logger::Backend {
+    // Channels with a level of their own (guarded by the callsite mutex)
+    std::map<std::string, LogLevel, std::less<>> channel_levels;
+
+    // Sinks (guarded by mutex_)
+    ConsoleSink console_sink;
+    FileSink file_sink;
+    binlog::Encoder binary_encoder;
+    std::string binary_record;
+
+    // Timestamps: records carry raw ticks, which the sinks convert
+    TickClock clock;
+    TimestampText timestamp_text;
+    std::uint64_t previous_ticks{0};
+
+    // Writes the records of the asynchronous queue (see asyncWorker_()).
+    // It parks on async_wake when idle; drainAsync_() waits on async_drained.
+    std::thread async_worker;
+    std::mutex async_mutex;
+    std::condition_variable async_wake;
+    std::condition_variable async_drained;
+};
+
+struct Logger::AsyncRecord {
+    LogLevel level{LogLevel::none};
+    bool to_console{false};
+    bool to_file{false};
+    // Packed records hold the format string followed by the packed
+    // arguments (see argpack.hpp); others hold the finished message
+    bool packed{false};
+    std::uint32_t format_size{0};
+    // Id of a callsite with a constant format string, for binary logs
+    std::size_t callsite_id{binlog::no_callsite};
+    // Clock reading when logged (see TickClock), if the configuration needs it
+    std::uint64_t ticks{0};
+    std::string text;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Initialization and finalization
 
-inline void Logger::initialize(
-    LogLevel level, LogTo destination, const std::string& filename) {
+PRESSIOLOG_INLINE void Logger::initialize(
+    LogLevel level, LogTo destination, const std::string& filename, LogMode mode) {
     std::call_once(init_flag_, [&]() {
-        setLoggingLevel(level);
-        setOutputStream(destination);
-        setOutputFilename(filename);
+        backend_->clock.calibrate();
+        // The environment is read once, and takes precedence over the arguments
+        const auto settings = env::read();
+        setLoggingLevel(settings.level.value_or(level));
+        setOutputStream(settings.destination.value_or(destination));
+        setOutputFilename(settings.filename.value_or(filename));
+        if (settings.timestamps) {
+            setTimestampMode(*settings.timestamps);
+        }
+        #if PRESSIO_ENABLE_TPL_MPI
+        if (settings.logging_rank) {
+            setLoggingRank(*settings.logging_rank);
+        }
+        #endif
+        for (const auto& channel : settings.channel_levels) {
+            setChannelLevel(channel.first, channel.second);
+        }
+        #if PRESSIO_ENABLE_COLORIZED_OUTPUT
+        backend_->console_sink.setColorize(ConsoleSink::stdoutIsTerminal());
+        #endif
         formatRankString_();
-        logger_is_initialized_.store(true, std::memory_order_release);
+        installFrontend_();
+        const auto log_mode = settings.mode.value_or(mode);
+        if (log_mode != LogMode::sync) {
+            startAsync_(log_mode);
+        }
+        updateConfig_([](ConfigSnapshot config) { return config.withInitialized(true); });
     });
-    if (logger_is_initialized_) {
-        log(LogLevel::info, colors::green("pressio-log initialized."));
+    if (config_.load().initialized()) {
+        log(LogLevel::info, "pressio-log initialized.");
     }
 }
 
 #if PRESSIO_ENABLE_TPL_MPI
-inline void Logger::initializeWithMPI(
+PRESSIOLOG_INLINE void Logger::initializeWithMPI(
     LogLevel level, LogTo destination, const std::string& filename,
-    int logging_rank, MPI_Comm comm) {
+    int logging_rank, MPI_Comm comm, LogMode mode) {
     // Check if MPI is initialized
     int flag = 0; MPI_Initialized( &flag );
     mpi_initialized_ = flag == 1 ? true : false;
@@ -88,84 +169,287 @@ inline void Logger::initializeWithMPI(
     // Set member variables and initialize
     setLoggingRank(logging_rank);
     setCommunicator(comm);
-    initialize(level, destination, filename);
+    initialize(level, destination, filename, mode);
 }
 #endif
 
-inline void Logger::finalize() {
-    log(LogLevel::info, colors::green("pressio-log finalized."));
-    return;
+PRESSIOLOG_INLINE void Logger::finalize() {
+    drainAsync_();
+    reportDropped_();
+    log(LogLevel::info, "pressio-log finalized.");
+    drainAsync_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->console_sink.flush();
+    backend_->file_sink.close();
+}
+
+PRESSIOLOG_INLINE void Logger::flush() {
+    drainAsync_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->console_sink.flush();
+    backend_->file_sink.flush();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Public logging functions
 
-inline void Logger::log(LogLevel level, const std::string& message) {
-    if (!logger_is_initialized_) {
-        std::call_once(init_warning_flag_, [&]() {
-            print_(formatWarning_(
-                "You are trying to use pressio-log, but it has not been initialized. "
-                "Initialize with PRESSIOLOG_INITIALIZE()."));
-        });
-        return;
+PRESSIOLOG_INLINE bool Logger::isEnabled(LogLevel level) const {
+    const auto config = config_.load();
+    // Let calls through before initialization so that log() can warn about it
+    return !config.initialized() or isEnabled_(config, level);
+}
+
+PRESSIOLOG_INLINE std::size_t Logger::droppedRecords(LogLevel level) const {
+    return async_dropped_[static_cast<std::size_t>(level)].load(std::memory_order_relaxed);
+}
+
+// Each call reads the configuration once, and uses that snapshot throughout
+
+PRESSIOLOG_INLINE void Logger::log(LogLevel level, std::string_view message) {
+    const auto config = config_.load();
+    if (shouldLog_(config, level, false)) {
+        log_(config, level, message);
+    }
+}
+
+// The callsite has already applied the logging level and its override
+
+PRESSIOLOG_INLINE void Logger::log(const Callsite&, LogLevel level, std::string_view message) {
+    const auto config = config_.load();
+    if (shouldLog_(config, level, true)) {
+        log_(config, level, message);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Callsites
+
+PRESSIOLOG_INLINE std::vector<CallsiteInfo> Logger::callsites() const {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    std::vector<CallsiteInfo> result(callsite_count_);
+    // The list is newest first; ids count up from 0
+    for (const Callsite* callsite = callsites_; callsite; callsite = callsite->next_) {
+        const std::size_t id = callsite->id_.load(std::memory_order_relaxed);
+        result[id] = CallsiteInfo{
+            id, callsite->level_, callsite->file_, callsite->line_,
+            callsite->function_, callsite->format_, callsite->channel_, callsite->state_,
+            Callsite::passes_(callsite->level_,
+                              callsite->threshold_.load(std::memory_order_relaxed))};
+    }
+    return result;
+}
+
+PRESSIOLOG_INLINE bool Logger::setCallsiteState(std::size_t id, CallsiteState state) {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    for (Callsite* callsite = callsites_; callsite; callsite = callsite->next_) {
+        if (callsite->id_.load(std::memory_order_relaxed) == id) {
+            callsite->state_ = state;
+            refreshCallsite_(*callsite, config_.load());
+            return true;
+        }
+    }
+    return false;
+}
+
+PRESSIOLOG_INLINE std::size_t Logger::enableCallsites(const std::string& pattern) {
+    return addCallsiteRule_(pattern, CallsiteState::enabled);
+}
+
+PRESSIOLOG_INLINE std::size_t Logger::disableCallsites(const std::string& pattern) {
+    return addCallsiteRule_(pattern, CallsiteState::disabled);
+}
+
+PRESSIOLOG_INLINE void Logger::resetCallsites() {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    callsite_rules_.clear();
+    const auto config = config_.load();
+    for (Callsite* callsite = callsites_; callsite; callsite = callsite->next_) {
+        callsite->state_ = CallsiteState::level;
+        refreshCallsite_(*callsite, config);
+    }
+}
+
+// Lets the logging macros reach the Logger (see frontend.hpp)
+PRESSIOLOG_INLINE void Logger::installFrontend_() {
+    frontend::entry_points = {
+        [](Callsite& callsite, LogLevel level) {
+            instance().registerCallsite_(callsite);
+            return Callsite::passes_(level, callsite.threshold_.load(std::memory_order_relaxed));
+        },
+        [](const Callsite& callsite, LogLevel level, std::string_view message) {
+            instance().log(callsite, level, message);
+        },
+        [](const Callsite& callsite, LogLevel level, std::string_view format,
+           bool constant_format, std::string_view packed) {
+            auto& logger = instance();
+            const auto config = logger.config_.load();
+            if (logger.shouldLog_(config, level, true)) {
+                // Binary logs look up constant format strings by callsite id
+                // (an id not yet seen by this thread reads as no_callsite)
+                static_assert(Callsite::no_id_ == binlog::no_callsite);
+                const std::size_t callsite_id = constant_format
+                    ? callsite.id_.load(std::memory_order_relaxed) : binlog::no_callsite;
+                logger.logPrepacked_(config, level, callsite_id, format, packed);
+            }
+        }
     };
+}
+
+PRESSIOLOG_INLINE void Logger::registerCallsite_(Callsite& callsite) {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    // Several threads may reach a new callsite at the same time
+    if (callsite.threshold_.load(std::memory_order_relaxed) != Callsite::unregistered_) {
+        return;
+    }
+    callsite.id_.store(callsite_count_++, std::memory_order_relaxed);
+    callsite.next_ = callsites_;
+    callsites_ = &callsite;
+    // Patterns also apply to callsites that first run after they were given
+    for (const auto& rule : callsite_rules_) {
+        if (detail::matchesCallsite(rule.first, callsite)) {
+            callsite.state_ = rule.second;
+        }
+    }
+    refreshCallsite_(callsite, config_.load());
+}
 
-    if (current_rank_ == logging_rank_) {
-        switch (level) {
-            case LogLevel::none:    return;
-            case LogLevel::sparse:   sparse_(message);   break;
-            case LogLevel::info:    info_(message);    break;
-            case LogLevel::debug:   debug_(message);   break;
-            case LogLevel::warning: warning_(message); break;
-            case LogLevel::error:   error_(message);   break;
+PRESSIOLOG_INLINE std::size_t Logger::addCallsiteRule_(const std::string& pattern, CallsiteState state) {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    callsite_rules_.emplace_back(pattern, state);
+    const auto config = config_.load();
+    std::size_t matched = 0;
+    for (Callsite* callsite = callsites_; callsite; callsite = callsite->next_) {
+        if (detail::matchesCallsite(pattern, *callsite)) {
+            callsite->state_ = state;
+            refreshCallsite_(*callsite, config);
+            ++matched;
         }
     }
+    return matched;
 }
 
-template <typename... Args>
-inline void Logger::log(LogLevel level, const std::string& fmt_str, Args&&... args) {
-    try {
-        std::string message = fmt::format(fmt::runtime(fmt_str), utils::prep_for_fmt(std::forward<Args>(args))...);
-        log(level, message);
-    } catch(const fmt::v11::format_error&) {
-        std::ostringstream oss;
-        oss << "fmt could not format given string: " << fmt_str << " with args:\n";
-        ((oss << "  " << std::to_string(args) << "\n"), ...);
-        throw std::runtime_error(oss.str());
+// The channel level is resolved here, so that logging calls only read the
+// callsite's cached threshold
+PRESSIOLOG_INLINE void Logger::refreshCallsite_(Callsite& callsite, ConfigSnapshot config) {
+    const auto level = resolveChannelLevel_(callsite.channel_, config.level());
+    callsite.threshold_.store(
+        Callsite::thresholdFor_(config.withLevel(level), callsite.state_),
+        std::memory_order_relaxed);
+}
+
+PRESSIOLOG_INLINE void Logger::refreshCallsites_() {
+    const auto config = config_.load();
+    for (Callsite* callsite = callsites_; callsite; callsite = callsite->next_) {
+        refreshCallsite_(*callsite, config);
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Channels
+
+PRESSIOLOG_INLINE void Logger::setChannelLevel(const std::string& channel, LogLevel level) {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    backend_->channel_levels[channel] = level;
+    refreshCallsites_();
+}
+
+PRESSIOLOG_INLINE void Logger::resetChannelLevel(const std::string& channel) {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    backend_->channel_levels.erase(channel);
+    refreshCallsites_();
+}
+
+PRESSIOLOG_INLINE LogLevel Logger::channelLevel(std::string_view channel) const {
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    return resolveChannelLevel_(channel, config_.load().level());
+}
+
+// Walks up "a.b.c" -> "a.b" -> "a" until a channel has a level of its own
+PRESSIOLOG_INLINE LogLevel Logger::resolveChannelLevel_(std::string_view channel, LogLevel level) const {
+    while (!channel.empty()) {
+        const auto it = backend_->channel_levels.find(channel);
+        if (it != backend_->channel_levels.end()) {
+            return it->second;
+        }
+        const auto dot = channel.rfind('.');
+        channel = dot == std::string_view::npos ? std::string_view() : channel.substr(0, dot);
+    }
+    return level;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Public setters
 
-inline void Logger::setLoggingLevel(LogLevel level) {
-    logging_level_ = level;
+PRESSIOLOG_INLINE void Logger::setLoggingLevel(LogLevel level) {
+    updateConfig_([level](ConfigSnapshot config) { return config.withLevel(level); });
 }
 
-inline void Logger::setOutputStream(LogTo destination) {
-    dst_ = destination;
-    setDestinationBools_();
+PRESSIOLOG_INLINE void Logger::setOutputStream(LogTo destination) {
+    updateConfig_([destination](ConfigSnapshot config) {
+        return config.withDestination(destination);
+    });
 }
 
-inline void Logger::setOutputFilename(const std::string& log_file_name) {
-    log_file_ = log_file_name;
+PRESSIOLOG_INLINE void Logger::setOutputFilename(const std::string& log_file_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->file_sink.setPath(log_file_name);
+}
+
+PRESSIOLOG_INLINE void Logger::setFileFormat(FileFormat format) {
+    // The sink's mode and the snapshot change together, as seen by the worker
+    std::lock_guard<std::mutex> lock(mutex_);
+    const bool binary = format == FileFormat::binary;
+    backend_->file_sink.setBinary(binary);
+    updateConfig_([binary](ConfigSnapshot config) { return config.withBinaryFile(binary); });
+}
+
+PRESSIOLOG_INLINE void Logger::setTimestampMode(TimestampMode mode) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    timestamp_mode_ = mode;
+    updateConfig_([mode](ConfigSnapshot config) {
+        return config.withTimestamps(mode != TimestampMode::none);
+    });
+}
+
+PRESSIOLOG_INLINE void Logger::setConsoleFlushPolicy(const FlushPolicy& policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->console_sink.setFlushPolicy(policy);
+}
+
+PRESSIOLOG_INLINE void Logger::setFileFlushPolicy(const FlushPolicy& policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->file_sink.setFlushPolicy(policy);
+}
+
+PRESSIOLOG_INLINE void Logger::setFileBufferSize(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    backend_->file_sink.setBufferSize(size);
+}
+
+PRESSIOLOG_INLINE void Logger::setAsyncQueueCapacity(std::size_t capacity) {
+    async_queue_capacity_ = capacity;
+}
+
+PRESSIOLOG_INLINE void Logger::setOverflowPolicy(const OverflowPolicy& policy) {
+    overflow_policy_ = policy;
 }
 
 #if PRESSIO_ENABLE_TPL_MPI
-inline void Logger::setLoggingRank(int rank) {
+PRESSIOLOG_INLINE void Logger::setLoggingRank(int rank) {
     if (mpi_initialized_) {
         int size;
         MPI_Comm_size(comm_, &size);
-        if (rank > size - 1 and logger_is_initialized_) {
+        if (rank > size - 1 and config_.load().initialized()) {
             log(LogLevel::warning, "Cannot target rank {} (current comm size is {})", rank, size);
         } else {
             logging_rank_ = rank;
+            updateLoggingRank_();
         }
-    } else if (logger_is_initialized_) {
+    } else if (config_.load().initialized()) {
         log(LogLevel::warning, "MPI is enabled but not initialized. Using serial logger.");
     }
 }
-inline void Logger::setCommunicator(MPI_Comm comm) {
+PRESSIOLOG_INLINE void Logger::setCommunicator(MPI_Comm comm) {
     comm_ = comm;
 }
 #endif
@@ -173,16 +457,258 @@ inline void Logger::setCommunicator(MPI_Comm comm) {
 ///////////////////////////////////////////////////////////////////////////////
 // Private constructor
 
-inline Logger::Logger() {}
+PRESSIOLOG_INLINE Logger::Logger() : backend_(std::make_unique<Backend>()) {}
+
+PRESSIOLOG_INLINE Logger::~Logger() {
+    stopAsync_();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Asynchronous logging
+//
+// Producers format their record in their own thread-local buffer and copy it
+// into a slot of the lock-free queue. A single background thread pops the
+// records and writes them to the sinks (under mutex_, which producers never
+// take in async mode). The worker runs until the logger is destroyed;
+// finalize() and flush() wait for everything queued so far to be written.
+// When the queue stays empty the worker parks on a condition variable, and
+// producers wake it after pushing (see wakeAsync_()).
+
+PRESSIOLOG_INLINE void Logger::startAsync_(LogMode mode) {
+    deferred_enabled_ = mode == LogMode::deferred;
+    async_queue_ = std::make_unique<AsyncQueue<AsyncRecord>>(async_queue_capacity_);
+    // Typical records then fit in their slot without allocating
+    async_queue_->initializeSlots([](AsyncRecord& record) {
+        record.text.reserve(256);
+    });
+    backend_->async_worker = std::thread([this]() { asyncWorker_(); });
+    async_enabled_.store(true, std::memory_order_release);
+}
+
+PRESSIOLOG_INLINE void Logger::stopAsync_() {
+    if (backend_->async_worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(backend_->async_mutex);
+            async_stop_.store(true, std::memory_order_release);
+        }
+        backend_->async_wake.notify_one();
+        backend_->async_worker.join();
+        async_enabled_.store(false, std::memory_order_release);
+    }
+}
+
+PRESSIOLOG_INLINE void Logger::drainAsync_() {
+    if (!async_enabled_.load(std::memory_order_acquire)) {
+        return;
+    }
+    const auto target = async_queue_->pushed();
+    // The worker notifies async_drained after each batch and before parking
+    std::unique_lock<std::mutex> lock(backend_->async_mutex);
+    backend_->async_drained.wait(lock, [this, target]() {
+        return async_processed_.load(std::memory_order_acquire)
+               + async_evicted_.load(std::memory_order_acquire) >= target;
+    });
+}
+
+// Wakes the worker if it is parked. The fence pairs with the one in
+// asyncWorker_(): either the worker sees the push before parking, or the
+// producer sees async_parked_ set.
+PRESSIOLOG_INLINE void Logger::wakeAsync_() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (async_parked_.load(std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> lock(backend_->async_mutex);
+        }
+        backend_->async_wake.notify_one();
+    }
+}
+
+// Pushes a record, applying the overflow policy while the queue is full
+template <typename Fill>
+inline void Logger::enqueue_(LogLevel level, const Fill& fill) {
+    if (async_queue_->tryPush(fill)) {
+        wakeAsync_();
+        return;
+    }
+    const auto& policy = overflow_policy_;
+    if (policy.action == OnOverflow::drop_newest and policy.mayDrop(level)) {
+        async_dropped_[static_cast<std::size_t>(level)].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // Removes the oldest record. One that must be kept is written right away
+    // (it may then appear just after records the worker was writing).
+    auto evict = [this, &policy](AsyncRecord& record) {
+        if (policy.mayDrop(record.level)) {
+            async_dropped_[static_cast<std::size_t>(record.level)].fetch_add(1, std::memory_order_relaxed);
+        } else {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writeRecord_(record);
+        }
+    };
+    while (!async_queue_->tryPush(fill)) {
+        if (policy.action == OnOverflow::drop_oldest and async_queue_->tryPop(evict)) {
+            async_evicted_.fetch_add(1, std::memory_order_release);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    wakeAsync_();
+}
+
+PRESSIOLOG_INLINE void Logger::asyncWorker_() {
+    constexpr std::size_t max_batch = 256;
+    std::size_t processed = 0;
+    int idle_rounds = 0;
+    // Records are swapped out of their slot before being written, so a slow
+    // sink never holds a slot (string capacity is exchanged, not reallocated)
+    AsyncRecord current;
+    current.text.reserve(256);
+    auto take = [&current](AsyncRecord& record) {
+        current.level = record.level;
+        current.to_console = record.to_console;
+        current.to_file = record.to_file;
+        current.packed = record.packed;
+        current.callsite_id = record.callsite_id;
+        current.format_size = record.format_size;
+        current.ticks = record.ticks;
+        current.text.swap(record.text);
+    };
+
+    while (true) {
+        // Read before draining, so every record pushed before the stop request is written
+        const bool stopping = async_stop_.load(std::memory_order_acquire);
+
+        std::size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (count < max_batch and async_queue_->tryPop(take)) {
+                writeRecord_(current);
+                ++count;
+            }
+        }
+
+        if (count > 0) {
+            processed += count;
+            {
+                std::lock_guard<std::mutex> lock(backend_->async_mutex);
+                async_processed_.store(processed, std::memory_order_release);
+            }
+            backend_->async_drained.notify_all();
+            idle_rounds = 0;
+            continue;
+        }
+
+        if (stopping and processed + async_evicted_.load(std::memory_order_acquire)
+                         == async_queue_->pushed()) {
+            break;
+        }
+
+        // Spins briefly while the queue is empty, then parks until a
+        // producer pushes a record or stopAsync_() is called
+        if (++idle_rounds < 64) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(backend_->async_mutex);
+        // Drains completed by producers evicting records (OnOverflow::drop_oldest)
+        backend_->async_drained.notify_all();
+        async_parked_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        backend_->async_wake.wait(lock, [this, processed]() {
+            return async_stop_.load(std::memory_order_acquire)
+                   or processed + async_evicted_.load(std::memory_order_acquire)
+                      != async_queue_->pushed();
+        });
+        async_parked_.store(false, std::memory_order_relaxed);
+        idle_rounds = 0;
+    }
+}
+
+// Like logFormatted_(), for arguments packed by the logging macros (see frontend.hpp)
+PRESSIOLOG_INLINE void Logger::logPrepacked_(ConfigSnapshot config, LogLevel level,
+                                             std::size_t callsite_id, std::string_view fmt_str,
+                                             std::string_view packed) {
+    // Formatted right away, as logFormatted_() would, unless the arguments
+    // are written to a binary file or (in deferred mode) formatted later
+    const bool binary = config.toFile() and config.binaryFile();
+    if (!binary and !(async_enabled_.load(std::memory_order_acquire) and deferred_enabled_)) {
+        utils::ScopedBuffer buffer;
+        try {
+            argpack::format(buffer.get(), fmt_str, packed);
+        } catch (const fmt::format_error& e) {
+            throw std::runtime_error(fmt::format(
+                "fmt could not format given string: {} ({})", fmt_str, e.what()));
+        }
+        log_(config, level, buffer.view());
+        return;
+    }
+    const std::uint64_t ticks = config.needsTime() ? TickClock::now() : 0;
+    if (async_enabled_.load(std::memory_order_acquire)) {
+        auto fill = [&](AsyncRecord& record) {
+            startPackedRecord_(record, config, level, ticks, callsite_id, fmt_str);
+            record.text.append(packed.data(), packed.size());
+        };
+        enqueue_(level, fill);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    writePacked_(config.toConsole(), config.toFile(), level, ticks, callsite_id, fmt_str, packed);
+}
+
+// Fills in a packed record up to its format string; the caller appends the arguments
+PRESSIOLOG_INLINE void Logger::startPackedRecord_(AsyncRecord& record, ConfigSnapshot config,
+                                                  LogLevel level, std::uint64_t ticks,
+                                                  std::size_t callsite_id, std::string_view fmt_str) {
+    record.level = level;
+    record.to_console = config.toConsole();
+    record.to_file = config.toFile();
+    record.packed = true;
+    record.callsite_id = callsite_id;
+    record.format_size = static_cast<std::uint32_t>(fmt_str.size());
+    record.ticks = ticks;
+    record.text.assign(fmt_str.data(), fmt_str.size());
+}
+
+PRESSIOLOG_INLINE void Logger::writeRecord_(AsyncRecord& record) {
+    if (record.packed) {
+        std::string_view text(record.text);
+        writePacked_(record.to_console, record.to_file, record.level, record.ticks,
+                     record.callsite_id, text.substr(0, record.format_size),
+                     text.substr(record.format_size));
+    } else {
+        writeSinks_(record.to_console, record.to_file, record.level, record.ticks, record.text);
+    }
+}
+
+// Logs how many records the overflow policy dropped, and resets the counts
+PRESSIOLOG_INLINE void Logger::reportDropped_() {
+    std::size_t total = 0;
+    fmt::memory_buffer counts;
+    for (auto level : {LogLevel::sparse, LogLevel::error, LogLevel::warning,
+                       LogLevel::info, LogLevel::debug}) {
+        const auto count = async_dropped_[static_cast<std::size_t>(level)].exchange(0);
+        if (count > 0) {
+            fmt::format_to(fmt::appender(counts), "{}{}: {}",
+                           total > 0 ? ", " : "", level, count);
+            total += count;
+        }
+    }
+    if (total > 0) {
+        log(LogLevel::warning,
+            "pressio-log dropped {} records because the queue was full ({})",
+            total, std::string_view(counts.data(), counts.size()));
+    }
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // MPI helpers
 
 #if PRESSIO_ENABLE_TPL_MPI
-inline void Logger::updateCurrentRank_() {
+PRESSIOLOG_INLINE void Logger::updateCurrentRank_() {
     if (mpi_initialized_) {
         MPI_Comm_rank(comm_, &current_rank_);
     }
+    updateLoggingRank_();
     formatRankString_();
 }
 #endif
@@ -190,84 +716,173 @@ inline void Logger::updateCurrentRank_() {
 ///////////////////////////////////////////////////////////////////////////////
 // Private setters
 
-inline void Logger::setInitialized_() {
-    logger_is_initialized_ = true;
+PRESSIOLOG_INLINE void Logger::updateLoggingRank_() {
+    const bool logging_rank = current_rank_ == logging_rank_;
+    updateConfig_([logging_rank](ConfigSnapshot config) {
+        return config.withLoggingRank(logging_rank);
+    });
 }
 
-inline void Logger::setDestinationBools_() {
-    should_write_ = (dst_ >= LogTo::file) ? true : false;
-    should_log_   = (dst_ == LogTo::console or dst_ == LogTo::both) ? true : false;
+///////////////////////////////////////////////////////////////////////////////
+// Filtering
+
+PRESSIOLOG_INLINE bool Logger::isEnabled_(ConfigSnapshot config, LogLevel level, bool level_checked) {
+    #if PRESSIO_SILENCE_WARNINGS
+    if (level == LogLevel::warning) {
+        return false;
+    }
+    #endif
+    if (level_checked) {
+        return config.loggingRank() and level != LogLevel::none;
+    }
+    return config.enabled(level);
+}
+
+PRESSIOLOG_INLINE bool Logger::shouldLog_(ConfigSnapshot config, LogLevel level, bool level_checked) {
+    if (!config.initialized()) {
+        warnUninitialized_();
+        return false;
+    }
+    return isEnabled_(config, level, level_checked);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Formatting
 
-inline void Logger::formatRankString_() {
-    rank_str_ = colors::green(fmt::format("[{}] ", current_rank_));
-}
-
-inline std::string Logger::formatWarning_(const std::string& message) const {
-    return colors::yellow(fmt::format("WARNING: {}", message));
+// The sinks color the rank (see LogLine)
+PRESSIOLOG_INLINE void Logger::formatRankString_() {
+    rank_str_ = fmt::format("[{}] ", current_rank_);
 }
 
-inline std::string Logger::formatError_(const std::string& message) const {
-    return colors::red(fmt::format("ERROR: {}", message));
+// Writes the time of a record (when it was logged, not written) and a space.
+// Runs in the sink, under mutex_.
+PRESSIOLOG_INLINE void Logger::formatTimestamp_(fmt::memory_buffer& buffer, std::uint64_t ticks) {
+    auto& backend = *backend_;
+    auto out = fmt::appender(buffer);
+    switch (timestamp_mode_) {
+        case TimestampMode::absolute:
+            buffer.append(backend.timestamp_text.format(backend.clock.wallTime(ticks)));
+            break;
+        case TimestampMode::since_start: {
+            const std::int64_t us = backend.clock.sinceStart(ticks) / 1000;
+            fmt::format_to(out, "{:>5}.{:06} ", us / 1000000, us % 1000000);
+            break;
+        }
+        case TimestampMode::delta: {
+            // Async records from different threads may be written slightly out of order
+            const auto delta = backend.previous_ticks == 0 ? 0
+                : backend.clock.nanoseconds(static_cast<std::int64_t>(ticks - backend.previous_ticks));
+            const std::int64_t us = (delta < 0 ? -delta : delta) / 1000;
+            fmt::format_to(out, "{}{}.{:06} ", delta < 0 ? '-' : '+', us / 1000000, us % 1000000);
+            break;
+        }
+        default:
+            break;
+    }
+    backend.previous_ticks = ticks;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Internal logging functions
+// Output Functions
 
-inline void Logger::sparse_(const std::string& message) {
-    if (logging_level_ >= LogLevel::sparse) {
-        log_(message);
-    }
+// The logging macros warn the same way (see frontend.hpp)
+PRESSIOLOG_INLINE void Logger::warnUninitialized_() {
+    frontend::warnUninitialized();
 }
-inline void Logger::error_(const std::string& message) {
-    if (logging_level_ >= LogLevel::error) {
-        log_(formatError_(message));
+
+PRESSIOLOG_INLINE void Logger::log_(ConfigSnapshot config, LogLevel level, std::string_view message) {
+    const std::uint64_t ticks = config.needsTime() ? TickClock::now() : 0;
+    if (async_enabled_.load(std::memory_order_acquire)) {
+        // The destination is captured now, so later changes don't affect queued records
+        auto fill = [&](AsyncRecord& record) {
+            record.level = level;
+            record.to_console = config.toConsole();
+            record.to_file = config.toFile();
+            record.packed = false;
+            record.ticks = ticks;
+            record.text.assign(message.data(), message.size());
+        };
+        enqueue_(level, fill);
+        return;
     }
+    std::lock_guard<std::mutex> lock(mutex_);
+    writeSinks_(config.toConsole(), config.toFile(), level, ticks, message);
 }
-inline void Logger::warning_(const std::string& message) {
-    #if not PRESSIO_SILENCE_WARNINGS
-    if (logging_level_ >= LogLevel::warning) {
-        log_(formatWarning_(message));
+
+PRESSIOLOG_INLINE void Logger::writeSinks_(bool to_console, bool to_file, LogLevel level,
+                                std::uint64_t ticks, std::string_view message) {
+    // Records logged before the configuration asked for time get it now
+    if (ticks == 0) {
+        ticks = TickClock::now();
     }
-    #endif
-}
-inline void Logger::info_(const std::string& message) {
-    if (logging_level_ >= LogLevel::info) {
-        log_(message);
+    const bool binary = to_file and config_.load().binaryFile();
+    if (to_console or (to_file and !binary)) {
+        // Each sink renders the rank and level itself (see LogLine)
+        utils::ScopedBuffer timestamp;
+        if (timestamp_mode_ != TimestampMode::none) {
+            formatTimestamp_(timestamp.get(), ticks);
+        }
+        const LogLine line{level, timestamp.view(), rank_str_, message};
+        if (to_console) print_(line);
+        if (to_file and !binary) write_(line);
     }
-}
-inline void Logger::debug_(const std::string& message) {
-    if (logging_level_ >= LogLevel::debug) {
-        log_(message);
+    if (binary) {
+        // Text records hold the plain line, as a text file would
+        utils::ScopedBuffer text;
+        LogLine{level, {}, rank_str_, message}.render(false, [&](std::string_view part) {
+            text.get().append(part);
+        });
+        beginBinaryRecord_();
+        auto& backend = *backend_;
+        backend.binary_encoder.text(backend.binary_record, level, backend.clock.wallTime(ticks), text.view());
+        backend.file_sink.writeBytes(level, backend.binary_record);
     }
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// Output Functions
+// Text output is formatted only if a text sink needs it; binary files get
+// the callsite's format string and the packed arguments
+PRESSIOLOG_INLINE void Logger::writePacked_(bool to_console, bool to_file, LogLevel level, std::uint64_t ticks,
+                                 std::size_t callsite_id, std::string_view fmt_str,
+                                 std::string_view packed) {
+    if (ticks == 0) {
+        ticks = TickClock::now();
+    }
+    const bool binary = to_file and config_.load().binaryFile();
+    if (to_console or (to_file and !binary)) {
+        // This runs after the logging call has returned, so a bad format
+        // string is reported in the output instead
+        utils::ScopedBuffer buffer;
+        argpack::tryFormat(buffer.get(), fmt_str, packed);
+        writeSinks_(to_console, to_file and !binary, level, ticks, buffer.view());
+    }
+    if (binary) {
+        beginBinaryRecord_();
+        auto& backend = *backend_;
+        backend.binary_encoder.message(backend.binary_record, level, backend.clock.wallTime(ticks), current_rank_,
+                                       callsite_id, fmt_str, packed);
+        backend.file_sink.writeBytes(level, backend.binary_record);
+    }
+}
 
-inline void Logger::log_(const std::string& message) {
-    auto out_str = rank_str_ + message;
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (should_log_)   print_(out_str);
-    if (should_write_) write_(out_str);
+PRESSIOLOG_INLINE void Logger::beginBinaryRecord_() {
+    // A new file (or a reopened one) starts a new session
+    auto& backend = *backend_;
+    if (!backend.file_sink.isOpen()) {
+        backend.binary_encoder.reset();
+    }
+    backend.binary_record.clear();
 }
 
-inline void Logger::print_(const std::string& message) {
-    std::cout << message << std::endl;
+// Flushed according to the console flush policy
+// (see PRESSIOLOG_SET_CONSOLE_FLUSH_POLICY)
+PRESSIOLOG_INLINE void Logger::print_(const LogLine& line) {
+    backend_->console_sink.write(line);
 }
 
-// TO DO: Opening/closing every time is inefficient.
-//        We could open on INITIALIZE() and close on
-//        FINALIZE(), but we would also want to flush
-//        periodically in case the run terminates early.
-inline void Logger::write_(const std::string& message) {
-    std::ofstream file;
-    file.open(log_file_, std::ios::app);
-    file << message << std::endl;
-    file.close();
+// The file stays open between messages and is flushed according to the
+// file flush policy (see PRESSIOLOG_SET_FILE_FLUSH_POLICY)
+PRESSIOLOG_INLINE void Logger::write_(const LogLine& line) {
+    backend_->file_sink.write(line);
 }
 
 } // end namespace pressiolog
@@ -0,0 +1,166 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// logger_templates.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_LOGGER_TEMPLATES_HPP_
+#define PRESSIOLOG_LOGGER_LOGGER_TEMPLATES_HPP_
+
+#include <stdexcept>
+
+#include "utils.hpp"
+#include "buffer.hpp"
+#include "argpack.hpp"
+#include "logger.hpp"
+
+/*
+ * Member templates of the Logger. These are instantiated in every
+ * translation unit that logs, so they are included in both the header-only
+ * and the compiled (PRESSIOLOG_COMPILED) builds; the other member functions
+ * are in logger_impl.hpp.
+ */
+
+namespace pressiolog {
+
+///////////////////////////////////////////////////////////////////////////////
+// Public logging functions
+
+template <typename... Args>
+inline void Logger::log(LogLevel level, utils::format_string<Args...> fmt_str, Args&&... args) {
+    const auto config = config_.load();
+    if (shouldLog_(config, level, false)) {
+        logFormatted_(config, level, Callsite::no_id_, fmt_str, std::forward<Args>(args)...);
+    }
+}
+
+template <typename... Args>
+inline void Logger::logFormatted(const Callsite& callsite, LogLevel level, std::string_view fmt_str,
+                                 bool constant_format, const Args&... args) {
+    logChecked<Args...>(callsite, level, constant_format, fmt::runtime(fmt_str), args...);
+}
+
+template <typename... Args>
+inline void Logger::logChecked(const Callsite& callsite, LogLevel level, bool constant_format,
+                               utils::format_string<const Args&...> fmt_str, const Args&... args) {
+    const auto config = config_.load();
+    if (shouldLog_(config, level, true)) {
+        // Binary logs look up constant format strings by callsite id (an id
+        // not yet seen by this thread reads as Callsite::no_id_)
+        const std::size_t callsite_id = constant_format
+            ? callsite.id_.load(std::memory_order_relaxed) : Callsite::no_id_;
+        logFormatted_<const Args&...>(config, level, callsite_id, fmt_str, args...);
+    }
+}
+
+template <typename... Args>
+inline void Logger::logFormatted_(ConfigSnapshot config, LogLevel level, std::size_t callsite_id,
+                                  utils::format_string<Args...> fmt_str, Args&&... args) {
+    // Arguments that can be copied as raw bytes are packed instead of
+    // formatted when they are written to a binary file, or (in deferred
+    // mode) formatted later by the background thread
+    if constexpr (argpack::are_packable_v<utils::fmt_arg_t<Args>...>) {
+        const bool binary = config.toFile() and config.binaryFile();
+        // deferred_enabled_ is published by the release store of async_enabled_,
+        // so it may only be read after that flag was seen set
+        if (binary or (async_enabled_.load(std::memory_order_acquire) and deferred_enabled_)) {
+            const fmt::string_view fmt_view(fmt_str);
+            logPacked_(
+                config, level, callsite_id, std::string_view(fmt_view.data(), fmt_view.size()),
+                utils::prep_for_fmt(std::forward<Args>(args))...);
+            return;
+        }
+    }
+    // The message is formatted in a reusable buffer; the sinks add the rank,
+    // level tag, and colors when they write it (see LogLine)
+    utils::ScopedBuffer buffer;
+    // Literal format strings are validated at compile time (C++20), so only
+    // strings built at run time can fail here
+    try {
+        fmt::format_to(
+            fmt::appender(buffer.get()), fmt_str,
+            utils::prep_for_fmt(std::forward<Args>(args))...);
+    } catch(const fmt::format_error& e) {
+        throw std::runtime_error(fmt::format(
+            "fmt could not format given string: {} ({})",
+            fmt::string_view(fmt_str), e.what()));
+    }
+    log_(config, level, buffer.view());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Callsites
+
+// Recomputes the cached state of every callsite after a configuration change
+// that affects it. Such changes (level, logging rank, initialization) are
+// rare, and serialize on the callsite mutex: the refresh reads the channel
+// levels and overrides it guards, and whichever refresh runs last uses the
+// newest snapshot, so no callsite keeps the threshold of an older one.
+template <typename Change>
+inline void Logger::updateConfig_(Change&& change) {
+    const auto previous = config_.update(change);
+    if (change(previous).filtering() == previous.filtering()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(callsite_mutex_);
+    refreshCallsites_();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Packed arguments
+
+// Packs the arguments, which logPrepacked_() queues or writes. The format
+// string is copied as well: it need not outlive the call.
+template <typename... Args>
+inline void Logger::logPacked_(ConfigSnapshot config, LogLevel level, std::size_t callsite_id,
+                               std::string_view fmt_str, const Args&... args) {
+    utils::ScopedBuffer packed;
+    argpack::packAll(packed.get(), args...);
+    logPrepacked_(config, level, callsite_id, fmt_str, packed.view());
+}
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_LOGGER_TEMPLATES_HPP_
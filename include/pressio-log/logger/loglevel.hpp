@@ -49,31 +49,41 @@
 #ifndef PRESSIOLOG_LOGGER_LOGLEVEL_HPP_
 #define PRESSIOLOG_LOGGER_LOGLEVEL_HPP_
 
-#include <iostream>
+#include <iosfwd>
+#include <string_view>
+
+#include "levelmacros.hpp"
 
 namespace pressiolog {
 
 enum class LogLevel : int {
-    none,
-    sparse,
-    error,
-    warning,
-    info,
-    debug
+    none    = PRESSIOLOG_LEVEL_NONE,
+    sparse  = PRESSIOLOG_LEVEL_SPARSE,
+    error   = PRESSIOLOG_LEVEL_ERROR,
+    warning = PRESSIOLOG_LEVEL_WARNING,
+    info    = PRESSIOLOG_LEVEL_INFO,
+    debug   = PRESSIOLOG_LEVEL_DEBUG
 };
 
-inline std::ostream& operator<<(std::ostream& os, LogLevel level) {
+constexpr std::string_view toString(LogLevel level) {
     switch (level) {
-        case LogLevel::none:    return os << "none";
-        case LogLevel::sparse:  return os << "sparse";
-        case LogLevel::error:   return os << "error";
-        case LogLevel::warning: return os << "warning";
-        case LogLevel::info:    return os << "info";
-        case LogLevel::debug:   return os << "debug";
-        default:                return os << "unknown";
+        case LogLevel::none:    return "none";
+        case LogLevel::sparse:  return "sparse";
+        case LogLevel::error:   return "error";
+        case LogLevel::warning: return "warning";
+        case LogLevel::info:    return "info";
+        case LogLevel::debug:   return "debug";
+        default:                return "unknown";
     }
 }
 
+// A template, so that this header only needs <iosfwd>. The names are string
+// literals, so data() is null-terminated (and works for any character type).
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, LogLevel level) {
+    return os << toString(level).data();
+}
+
 } // end namespace pressiolog
 
 #endif // PRESSIOLOG_LOGGER_LOGLEVEL_HPP_
@@ -0,0 +1,98 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// logline.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_LOGLINE_HPP_
+#define PRESSIOLOG_LOGGER_LOGLINE_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+#include "loglevel.hpp"
+#include "colors.hpp"
+
+namespace pressiolog {
+
+/*
+ * A log record on its way to the sinks, with the rank and level kept apart
+ * from the formatted message so each sink can render them its own way: the
+ * console colors them (on a terminal), files get plain text. The message
+ * and timestamp are formatted once, whatever the number of sinks.
+ */
+struct LogLine {
+    LogLevel level;
+    std::string_view timestamp; // the time followed by a space, or empty
+    std::string_view rank;      // "[0] ", or empty
+    std::string_view text;      // the formatted message
+
+    // Calls put(std::string_view) on each non-empty part of the line (without
+    // the line break), and returns the total size
+    template <typename Put>
+    std::size_t render(bool colorize, Put&& put) const {
+        std::size_t size = 0;
+        auto part = [&](std::string_view str) {
+            if (!str.empty()) {
+                put(str);
+                size += str.size();
+            }
+        };
+        part(timestamp);
+        if (!rank.empty()) {
+            part(colors::when(colorize, colors::green));
+            part(rank);
+            part(colors::when(colorize, colors::reset));
+        }
+        part(colors::prefix(level, colorize));
+        part(text);
+        part(colors::suffix(level, colorize));
+        return size;
+    }
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_LOGLINE_HPP_
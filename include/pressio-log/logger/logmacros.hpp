@@ -0,0 +1,273 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// logmacros.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_LOGMACROS_HPP_
+#define PRESSIOLOG_LOGGER_LOGMACROS_HPP_
+
+/*
+ * The logging macros. Only preprocessor definitions: the declarations they
+ * use come from macros.hpp, core.hpp, or the pressio.log module.
+ */
+
+#include "levelmacros.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Compile-time logging floor
+//
+// Messages more verbose than PRESSIOLOG_ACTIVE_LEVEL are removed by the
+// preprocessor: neither the call nor its arguments are compiled. Define it
+// before including pressio-log, e.g.
+//     -D PRESSIOLOG_ACTIVE_LEVEL=PRESSIOLOG_LEVEL_INFO
+
+#ifndef PRESSIOLOG_ACTIVE_LEVEL
+    #define PRESSIOLOG_ACTIVE_LEVEL PRESSIOLOG_LEVEL_DEBUG
+#endif
+
+#define PRESSIOLOG_DISABLED_(...) static_cast<void>(0);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard logging macros
+
+// Each expansion owns a static pressiolog::Callsite (see callsite.hpp), which
+// caches whether its messages are enabled at the current logging level and on
+// the current rank. The arguments are only evaluated (and formatted) if so.
+//
+// The message goes through frontend::logFromMacro(), found by argument-
+// dependent lookup so that the overload core.hpp adds is used wherever it is
+// visible (see frontend.hpp). Next to the Callsite, the expansion declares a
+// type that returns the source text of the format argument, from which that
+// overload checks a literal format string without consteval (C++17).
+
+#define PRESSIOLOG_ENABLED_(callsite, level) (callsite).enabled(level)
+#define PRESSIOLOG_EMIT_(callsite, level, ...) \
+    logFromMacro(pressiolog::frontend::Typed<callsite##format_>{}, callsite, level, __VA_ARGS__)
+
+#define PRESSIOLOG_CALLSITE_(name, channel, level, ...) \
+    static pressiolog::Callsite name( \
+        level, __FILE__, __LINE__, __func__, PRESSIOLOG_FORMAT_TEXT_(__VA_ARGS__, ), channel); \
+    struct name##format_ { \
+        static constexpr const char* text() { return PRESSIOLOG_FORMAT_TEXT_(__VA_ARGS__, ); } \
+    }
+
+#define PRESSIOLOG_FORMAT_TEXT_(format, ...) #format
+
+#define PRESSIOLOG_LOG_CHANNEL_(channel, level, ...) \
+   do { \
+       if (static_cast<int>(level) <= PRESSIOLOG_ACTIVE_LEVEL) { \
+           PRESSIOLOG_CALLSITE_(pressiolog_callsite_, channel, level, __VA_ARGS__); \
+           if (PRESSIOLOG_ENABLED_(pressiolog_callsite_, level)) \
+               PRESSIOLOG_EMIT_(pressiolog_callsite_, level, __VA_ARGS__); \
+       } \
+   } while (0);
+
+// The level may be computed at run time. Each call is then filtered at its
+// own level, but the callsite (see Logger::callsites()) reports the level of
+// its first call, and its static Callsite is initialized on that call.
+#define LOG(level, ...) PRESSIOLOG_LOG_CHANNEL_("", level, __VA_ARGS__)
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_SPARSE
+    #define PRESSIOLOG_SPARSE(...)  LOG(pressiolog::LogLevel::sparse,  __VA_ARGS__)
+#else
+    #define PRESSIOLOG_SPARSE(...)  PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_INFO
+    #define PRESSIOLOG_INFO(...)    LOG(pressiolog::LogLevel::info,    __VA_ARGS__)
+#else
+    #define PRESSIOLOG_INFO(...)    PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_DEBUG
+    #define PRESSIOLOG_DEBUG(...)   LOG(pressiolog::LogLevel::debug,   __VA_ARGS__)
+#else
+    #define PRESSIOLOG_DEBUG(...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_WARNING
+    #define PRESSIOLOG_WARNING(...) LOG(pressiolog::LogLevel::warning, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_WARNING(...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_ERROR
+    #define PRESSIOLOG_ERROR(...)   LOG(pressiolog::LogLevel::error,   __VA_ARGS__)
+#else
+    #define PRESSIOLOG_ERROR(...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Channel logging macros
+//
+// PRESSIOLOG_<LEVEL>_CH("solvers.newton", ...) logs to a named channel, whose
+// level can be set with PRESSIOLOG_SET_CHANNEL_LEVEL (see Logger). The channel
+// must be a string literal. The check costs the same as for the macros above.
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_SPARSE
+    #define PRESSIOLOG_SPARSE_CH(channel, ...) \
+        PRESSIOLOG_LOG_CHANNEL_(channel, pressiolog::LogLevel::sparse, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_SPARSE_CH(channel, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_INFO
+    #define PRESSIOLOG_INFO_CH(channel, ...) \
+        PRESSIOLOG_LOG_CHANNEL_(channel, pressiolog::LogLevel::info, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_INFO_CH(channel, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_DEBUG
+    #define PRESSIOLOG_DEBUG_CH(channel, ...) \
+        PRESSIOLOG_LOG_CHANNEL_(channel, pressiolog::LogLevel::debug, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_DEBUG_CH(channel, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_WARNING
+    #define PRESSIOLOG_WARNING_CH(channel, ...) \
+        PRESSIOLOG_LOG_CHANNEL_(channel, pressiolog::LogLevel::warning, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_WARNING_CH(channel, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_ERROR
+    #define PRESSIOLOG_ERROR_CH(channel, ...) \
+        PRESSIOLOG_LOG_CHANNEL_(channel, pressiolog::LogLevel::error, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_ERROR_CH(channel, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Rate-limited logging macros
+//
+// For messages inside loops that run many times:
+//     PRESSIOLOG_<LEVEL>_EVERY_N(n, ...)    every n-th time
+//     PRESSIOLOG_<LEVEL>_FIRST_N(n, ...)    the first n times
+//     PRESSIOLOG_<LEVEL>_ONCE(...)          the first time
+//     PRESSIOLOG_<LEVEL>_EVERY_MS(ms, ...)  at most once every ms milliseconds
+// Each callsite keeps its own counter or timestamp, which only advances while
+// the callsite is enabled. As with the macros above, the arguments are only
+// evaluated when the message is emitted.
+
+#define PRESSIOLOG_LOG_LIMITED_(level, state_type, allow, ...) \
+   do { \
+       PRESSIOLOG_CALLSITE_(pressiolog_callsite_, "", level, __VA_ARGS__); \
+       static state_type pressiolog_rate_state_; \
+       if (PRESSIOLOG_ENABLED_(pressiolog_callsite_, level) and pressiolog_rate_state_.allow) \
+           PRESSIOLOG_EMIT_(pressiolog_callsite_, level, __VA_ARGS__); \
+   } while (0);
+
+#define PRESSIOLOG_LOG_EVERY_N_(level, n, ...) \
+    PRESSIOLOG_LOG_LIMITED_(level, pressiolog::ratelimit::Counter, everyN(n), __VA_ARGS__)
+#define PRESSIOLOG_LOG_FIRST_N_(level, n, ...) \
+    PRESSIOLOG_LOG_LIMITED_(level, pressiolog::ratelimit::Counter, firstN(n), __VA_ARGS__)
+#define PRESSIOLOG_LOG_EVERY_MS_(level, ms, ...) \
+    PRESSIOLOG_LOG_LIMITED_(level, pressiolog::ratelimit::Interval, \
+                            every(std::chrono::milliseconds(ms)), __VA_ARGS__)
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_SPARSE
+    #define PRESSIOLOG_SPARSE_EVERY_N(n, ...)   PRESSIOLOG_LOG_EVERY_N_(pressiolog::LogLevel::sparse, n, __VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_FIRST_N(n, ...)   PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::sparse, n, __VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_ONCE(...)         PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::sparse, 1, __VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_EVERY_MS(ms, ...) PRESSIOLOG_LOG_EVERY_MS_(pressiolog::LogLevel::sparse, ms, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_SPARSE_EVERY_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_FIRST_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_ONCE(...)         PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_SPARSE_EVERY_MS(ms, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_INFO
+    #define PRESSIOLOG_INFO_EVERY_N(n, ...)   PRESSIOLOG_LOG_EVERY_N_(pressiolog::LogLevel::info, n, __VA_ARGS__)
+    #define PRESSIOLOG_INFO_FIRST_N(n, ...)   PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::info, n, __VA_ARGS__)
+    #define PRESSIOLOG_INFO_ONCE(...)         PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::info, 1, __VA_ARGS__)
+    #define PRESSIOLOG_INFO_EVERY_MS(ms, ...) PRESSIOLOG_LOG_EVERY_MS_(pressiolog::LogLevel::info, ms, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_INFO_EVERY_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_INFO_FIRST_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_INFO_ONCE(...)         PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_INFO_EVERY_MS(ms, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_DEBUG
+    #define PRESSIOLOG_DEBUG_EVERY_N(n, ...)   PRESSIOLOG_LOG_EVERY_N_(pressiolog::LogLevel::debug, n, __VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_FIRST_N(n, ...)   PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::debug, n, __VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_ONCE(...)         PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::debug, 1, __VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_EVERY_MS(ms, ...) PRESSIOLOG_LOG_EVERY_MS_(pressiolog::LogLevel::debug, ms, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_DEBUG_EVERY_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_FIRST_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_ONCE(...)         PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_DEBUG_EVERY_MS(ms, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_WARNING
+    #define PRESSIOLOG_WARNING_EVERY_N(n, ...)   PRESSIOLOG_LOG_EVERY_N_(pressiolog::LogLevel::warning, n, __VA_ARGS__)
+    #define PRESSIOLOG_WARNING_FIRST_N(n, ...)   PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::warning, n, __VA_ARGS__)
+    #define PRESSIOLOG_WARNING_ONCE(...)         PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::warning, 1, __VA_ARGS__)
+    #define PRESSIOLOG_WARNING_EVERY_MS(ms, ...) PRESSIOLOG_LOG_EVERY_MS_(pressiolog::LogLevel::warning, ms, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_WARNING_EVERY_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_WARNING_FIRST_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_WARNING_ONCE(...)         PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_WARNING_EVERY_MS(ms, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#if PRESSIOLOG_ACTIVE_LEVEL >= PRESSIOLOG_LEVEL_ERROR
+    #define PRESSIOLOG_ERROR_EVERY_N(n, ...)   PRESSIOLOG_LOG_EVERY_N_(pressiolog::LogLevel::error, n, __VA_ARGS__)
+    #define PRESSIOLOG_ERROR_FIRST_N(n, ...)   PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::error, n, __VA_ARGS__)
+    #define PRESSIOLOG_ERROR_ONCE(...)         PRESSIOLOG_LOG_FIRST_N_(pressiolog::LogLevel::error, 1, __VA_ARGS__)
+    #define PRESSIOLOG_ERROR_EVERY_MS(ms, ...) PRESSIOLOG_LOG_EVERY_MS_(pressiolog::LogLevel::error, ms, __VA_ARGS__)
+#else
+    #define PRESSIOLOG_ERROR_EVERY_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_ERROR_FIRST_N(n, ...)   PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_ERROR_ONCE(...)         PRESSIOLOG_DISABLED_(__VA_ARGS__)
+    #define PRESSIOLOG_ERROR_EVERY_MS(ms, ...) PRESSIOLOG_DISABLED_(__VA_ARGS__)
+#endif
+
+#endif // PRESSIOLOG_LOGGER_LOGMACROS_HPP_
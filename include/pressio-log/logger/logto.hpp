@@ -49,6 +49,8 @@
 #ifndef PRESSIOLOG_LOGGER_LOGTO_HPP_
 #define PRESSIOLOG_LOGGER_LOGTO_HPP_
 
+#include <string_view>
+
 namespace pressiolog {
 
 enum class LogTo : int {
@@ -57,6 +59,15 @@ enum class LogTo : int {
     both
 };
 
+constexpr std::string_view toString(LogTo destination) {
+    switch (destination) {
+        case LogTo::console: return "console";
+        case LogTo::file:    return "file";
+        case LogTo::both:    return "both";
+        default:             return "unknown";
+    }
+}
+
 } // end namespace pressiolog
 
 #endif // PRESSIOLOG_LOGGER_LOGTO_HPP_
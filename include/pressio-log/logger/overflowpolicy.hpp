@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// overflowpolicy.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_OVERFLOWPOLICY_HPP_
+#define PRESSIOLOG_LOGGER_OVERFLOWPOLICY_HPP_
+
+#include <string_view>
+
+#include "loglevel.hpp"
+
+namespace pressiolog {
+
+// What a logging thread does when the asynchronous queue is full
+enum class OnOverflow : int {
+    block,        // wait until the background thread has made room
+    drop_newest,  // discard the record being logged
+    drop_oldest   // discard the oldest queued record to make room
+};
+
+constexpr std::string_view toString(OnOverflow action) {
+    switch (action) {
+        case OnOverflow::block:       return "block";
+        case OnOverflow::drop_newest: return "drop_newest";
+        case OnOverflow::drop_oldest: return "drop_oldest";
+        default:                      return "unknown";
+    }
+}
+
+/*
+ * Determines what happens to records that do not fit in the asynchronous
+ * queue (LogMode::async and LogMode::deferred).
+ *
+ * Records at keep_level or more important (sparse and error, by default)
+ * are never dropped: the logging thread waits for room instead. The logger
+ * counts the dropped records per level and reports them at finalize().
+ */
+struct OverflowPolicy {
+    OnOverflow action{OnOverflow::block};
+
+    // Least important level that is never dropped (error at the least)
+    LogLevel keep_level{LogLevel::error};
+
+    bool mayDrop(LogLevel level) const {
+        return action != OnOverflow::block
+           and level > keep_level
+           and level > LogLevel::error;
+    }
+
+    static OverflowPolicy block() {
+        return OverflowPolicy{};
+    }
+
+    static OverflowPolicy dropNewest(LogLevel keep_level = LogLevel::error) {
+        return OverflowPolicy{OnOverflow::drop_newest, keep_level};
+    }
+
+    static OverflowPolicy dropOldest(LogLevel keep_level = LogLevel::error) {
+        return OverflowPolicy{OnOverflow::drop_oldest, keep_level};
+    }
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_OVERFLOWPOLICY_HPP_
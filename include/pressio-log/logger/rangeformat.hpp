@@ -0,0 +1,288 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// rangeformat.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_RANGEFORMAT_HPP_
+#define PRESSIOLOG_LOGGER_RANGEFORMAT_HPP_
+
+#include <pressio-log/fmt/fmt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace pressiolog {
+
+/*
+ * Formatting of large vectors and matrices in log messages:
+ *
+ *     PRESSIOLOG_INFO("x = {}", pressiolog::range(x));
+ *     // x = [1, 2, 3, 4, 5, ... 2038 more ..., 2044, 2045, 2046, 2047, 2048]
+ *
+ *     pressiolog::RangeOptions options;
+ *     options.max_elements = 4;
+ *     options.stats = true;
+ *     PRESSIOLOG_INFO("J = {:.3e}", pressiolog::matrix(J.data(), J.rows(), J.cols(),
+ *                                                      pressiolog::MatrixLayout::col_major, options));
+ *
+ * Only the elements that are shown are formatted, straight into the message.
+ * The format specification (e.g. ".3e") applies to each element. range()
+ * takes anything contiguous with std::data() and std::size() (std::vector,
+ * std::array, arrays, spans, Eigen vectors, Kokkos views, ...); matrix()
+ * takes a pointer to densely stored elements. The data is only read while
+ * the message is formatted, which happens before the logging call returns.
+ */
+
+struct RangeOptions {
+    // Largest number of elements shown (per row, and rows, for matrices).
+    // Longer ranges show their first and last elements.
+    std::size_t max_elements{10};
+    // Significant digits of floating-point elements (unless the format
+    // specification sets them); -1 prints the shortest exact representation
+    int precision{-1};
+    // Append the number of elements, minimum, maximum, and Euclidean norm
+    // (computed over all elements, for arithmetic types)
+    bool stats{false};
+};
+
+enum class MatrixLayout : int {
+    row_major,  // e.g. C arrays, Kokkos::LayoutRight
+    col_major   // e.g. Eigen (by default), Kokkos::LayoutLeft
+};
+
+template <typename T>
+struct RangeView {
+    const T* data;
+    std::size_t size;
+    RangeOptions options;
+};
+
+template <typename T>
+struct MatrixView {
+    const T* data;
+    std::size_t rows;
+    std::size_t cols;
+    MatrixLayout layout;
+    RangeOptions options;
+
+    const T& operator()(std::size_t row, std::size_t col) const {
+        return layout == MatrixLayout::row_major ? data[row * cols + col] : data[col * rows + row];
+    }
+};
+
+template <typename T>
+RangeView<T> range(const T* data, std::size_t size, const RangeOptions& options = {}) {
+    return RangeView<T>{data, size, options};
+}
+
+template <typename Range>
+auto range(const Range& r, const RangeOptions& options = {})
+    -> RangeView<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(r))>>> {
+    return {std::data(r), static_cast<std::size_t>(std::size(r)), options};
+}
+
+template <typename T>
+MatrixView<T> matrix(const T* data, std::size_t rows, std::size_t cols,
+                     MatrixLayout layout = MatrixLayout::row_major,
+                     const RangeOptions& options = {}) {
+    return MatrixView<T>{data, rows, cols, layout, options};
+}
+
+namespace detail {
+
+// Formats single elements with the format specification of the range
+template <typename T>
+class ElementFormatter {
+    public:
+        constexpr auto parse(fmt::format_parse_context& ctx) {
+            has_specs_ = ctx.begin() != ctx.end() and *ctx.begin() != '}';
+            return formatter_.parse(ctx);
+        }
+
+        template <typename FormatContext>
+        auto format(const T& value, int precision, FormatContext& ctx) const {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (!has_specs_ and precision >= 0) {
+                    return fmt::format_to(ctx.out(), "{:.{}g}", value, precision);
+                }
+            }
+            return formatter_.format(value, ctx);
+        }
+
+    private:
+        fmt::formatter<T> formatter_;
+        bool has_specs_{false};
+};
+
+// Writes "[a, b, ... n more ..., y, z]", with write(i) formatting item i
+template <typename FormatContext, typename Write>
+auto writeElided(FormatContext& ctx, std::size_t size, std::size_t max_items,
+                 std::string_view items, Write&& write) {
+    const bool elided = size > max_items;
+    const std::size_t head = elided ? (max_items + 1) / 2 : size;
+    const std::size_t tail = elided ? max_items / 2 : 0;
+    auto out = ctx.out();
+    *out++ = '[';
+    auto separate = [&](std::size_t i) {
+        if (i > 0) {
+            *out++ = ',';
+            *out++ = ' ';
+        }
+        ctx.advance_to(out);
+    };
+    for (std::size_t i = 0; i < head; ++i) {
+        separate(i);
+        out = write(i);
+    }
+    if (elided) {
+        separate(head);
+        out = fmt::format_to(out, "... {} more{} ...", size - head - tail, items);
+    }
+    for (std::size_t i = size - tail; i < size; ++i) {
+        separate(i);
+        out = write(i);
+    }
+    *out++ = ']';
+    return out;
+}
+
+// Writes ", min=..., max=..., norm=...)" over every element (the caller
+// writes the opening parenthesis and the element count)
+template <typename T, typename FormatContext, typename Get>
+auto writeStats(FormatContext& ctx, const ElementFormatter<T>& element, int precision,
+                std::size_t size, Get&& get) {
+    auto out = ctx.out();
+    if constexpr (std::is_arithmetic_v<T>) {
+        if (size > 0) {
+            T min = get(0);
+            T max = get(0);
+            double squares = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                const T& value = get(i);
+                min = std::min(min, value);
+                max = std::max(max, value);
+                squares += static_cast<double>(value) * static_cast<double>(value);
+            }
+            out = fmt::format_to(out, ", min=");
+            ctx.advance_to(out);
+            out = element.format(min, precision, ctx);
+            out = fmt::format_to(out, ", max=");
+            ctx.advance_to(out);
+            out = element.format(max, precision, ctx);
+            out = precision >= 0
+                ? fmt::format_to(out, ", norm={:.{}g}", std::sqrt(squares), precision)
+                : fmt::format_to(out, ", norm={}", std::sqrt(squares));
+        }
+    }
+    *out++ = ')';
+    return out;
+}
+
+} // end namespace detail
+
+} // end namespace pressiolog
+
+template <typename T>
+struct fmt::formatter<pressiolog::RangeView<T>> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        return element_.parse(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(const pressiolog::RangeView<T>& range, FormatContext& ctx) const {
+        const auto& options = range.options;
+        auto out = pressiolog::detail::writeElided(
+            ctx, range.size, options.max_elements, "", [&](std::size_t i) {
+                return element_.format(range.data[i], options.precision, ctx);
+            });
+        if (options.stats) {
+            ctx.advance_to(fmt::format_to(out, " (n={}", range.size));
+            out = pressiolog::detail::writeStats(
+                ctx, element_, options.precision, range.size,
+                [&](std::size_t i) -> const T& { return range.data[i]; });
+        }
+        return out;
+    }
+
+    private:
+        pressiolog::detail::ElementFormatter<T> element_;
+};
+
+template <typename T>
+struct fmt::formatter<pressiolog::MatrixView<T>> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        return element_.parse(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(const pressiolog::MatrixView<T>& matrix, FormatContext& ctx) const {
+        const auto& options = matrix.options;
+        auto out = pressiolog::detail::writeElided(
+            ctx, matrix.rows, options.max_elements, " rows", [&](std::size_t row) {
+                return pressiolog::detail::writeElided(
+                    ctx, matrix.cols, options.max_elements, "", [&](std::size_t col) {
+                        return element_.format(matrix(row, col), options.precision, ctx);
+                    });
+            });
+        if (options.stats) {
+            ctx.advance_to(fmt::format_to(out, " ({}x{}", matrix.rows, matrix.cols));
+            // Every element, in storage order
+            out = pressiolog::detail::writeStats(
+                ctx, element_, options.precision, matrix.rows * matrix.cols,
+                [&](std::size_t i) -> const T& { return matrix.data[i]; });
+        }
+        return out;
+    }
+
+    private:
+        pressiolog::detail::ElementFormatter<T> element_;
+};
+
+#endif // PRESSIOLOG_LOGGER_RANGEFORMAT_HPP_
@@ -0,0 +1,111 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ratelimit.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_RATELIMIT_HPP_
+#define PRESSIOLOG_LOGGER_RATELIMIT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace pressiolog { namespace ratelimit {
+
+/*
+ * Per-callsite state of the rate-limited logging macros (e.g.
+ * PRESSIOLOG_DEBUG_EVERY_N). Each macro expansion owns a static instance;
+ * both types are constant-initialized, so they cost no guard check.
+ */
+
+// Counts the enabled occurrences of a callsite
+class Counter {
+    public:
+        constexpr Counter() = default;
+
+        // True for occurrences 0, n, 2n, ...
+        bool everyN(std::uint64_t n) {
+            return count_.fetch_add(1, std::memory_order_relaxed) % (n > 0 ? n : 1) == 0;
+        }
+
+        // True for the first n occurrences. Once they are used up, the
+        // counter is only read, so a hot loop does not keep writing to it
+        bool firstN(std::uint64_t n) {
+            if (count_.load(std::memory_order_relaxed) >= n) {
+                return false;
+            }
+            return count_.fetch_add(1, std::memory_order_relaxed) < n;
+        }
+
+    private:
+        std::atomic<std::uint64_t> count_{0};
+};
+
+// Remembers when a callsite may emit next
+class Interval {
+    public:
+        constexpr Interval() = default;
+
+        // True at most once per interval (and for the first occurrence)
+        bool every(std::chrono::milliseconds interval) {
+            const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            std::int64_t next = next_.load(std::memory_order_relaxed);
+            if (now < next) {
+                return false;
+            }
+            // Only one of several threads arriving together wins the slot
+            const std::int64_t step = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+            return next_.compare_exchange_strong(next, now + step, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::int64_t> next_{0};
+};
+
+}} // end namespace pressiolog::ratelimit
+
+#endif // PRESSIOLOG_LOGGER_RATELIMIT_HPP_
@@ -0,0 +1,201 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// streamed.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_STREAMED_HPP_
+#define PRESSIOLOG_LOGGER_STREAMED_HPP_
+
+#include <pressio-log/fmt/fmt.h>
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string_view>
+
+namespace pressiolog { namespace utils {
+
+/*
+ * Stream buffer that hands what is written to it to a fmt output iterator,
+ * through a small put area, so operator<< writes straight into the buffer
+ * the message is formatted in.
+ */
+class AppenderStreambuf : public std::streambuf {
+    public:
+        AppenderStreambuf() {
+            setp(area_, area_ + sizeof(area_));
+        }
+
+        // Sets the output; flush() must be called before it goes out of scope
+        void setOutput(fmt::appender* out) {
+            out_ = out;
+        }
+
+        void flush() {
+            *out_ = std::copy(pbase(), pptr(), *out_);
+            setp(area_, area_ + sizeof(area_));
+        }
+
+    protected:
+        int_type overflow(int_type ch) override {
+            flush();
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+            return traits_type::not_eof(ch);
+        }
+
+        std::streamsize xsputn(const char* s, std::streamsize n) override {
+            if (n <= epptr() - pptr()) {
+                std::copy(s, s + n, pptr());
+                pbump(static_cast<int>(n));
+            } else {
+                flush();
+                *out_ = std::copy(s, s + n, *out_);
+            }
+            return n;
+        }
+
+        int sync() override {
+            flush();
+            return 0;
+        }
+
+    private:
+        char area_[256];
+        fmt::appender* out_{nullptr};
+};
+
+namespace detail {
+
+struct StreamState {
+    AppenderStreambuf streambuf;
+    std::ostream stream{&streambuf};
+    bool in_use{false};
+};
+
+// The stream of this thread, shared by all streamed types
+inline StreamState& streamState() {
+    thread_local StreamState state;
+    return state;
+}
+
+} // end namespace detail
+
+/*
+ * Writes value with operator<< to out.
+ *
+ * Each thread reuses one std::ostream, so formatting a streamable argument
+ * costs neither a stream construction nor a temporary string. If the stream
+ * is already in use on this thread (e.g. an operator<< that logs), a local
+ * std::ostringstream is used instead.
+ */
+template <typename T>
+fmt::appender writeStreamed(fmt::appender out, const T& value) {
+    auto& state = detail::streamState();
+    if (state.in_use) {
+        std::ostringstream oss;
+        oss << value;
+        const auto str = oss.str();
+        return std::copy(str.begin(), str.end(), out);
+    }
+    state.in_use = true;
+    state.streambuf.setOutput(&out);
+    // Start from the default stream state, like a new stream would
+    auto& stream = state.stream;
+    stream.clear();
+    stream.flags(std::ios_base::skipws | std::ios_base::dec);
+    stream.precision(6);
+    stream.width(0);
+    stream.fill(' ');
+    try {
+        stream << value;
+    } catch (...) {
+        state.streambuf.flush();
+        state.in_use = false;
+        throw;
+    }
+    state.streambuf.flush();
+    state.in_use = false;
+    return out;
+}
+
+// An argument that fmt cannot format, to be written with operator<<
+// (see prep_for_fmt() in utils.hpp)
+template <typename T>
+struct Streamed {
+    const T& value;
+};
+
+}} // end namespace pressiolog::utils
+
+// Without format specifications, the value is streamed straight into the
+// output. Otherwise (e.g. "{:>20}") it is streamed into a buffer first, and
+// padded or truncated like a string.
+template <typename T>
+struct fmt::formatter<pressiolog::utils::Streamed<T>> : fmt::formatter<fmt::string_view> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        has_specs_ = ctx.begin() != ctx.end() and *ctx.begin() != '}';
+        return fmt::formatter<fmt::string_view>::parse(ctx);
+    }
+
+    auto format(const pressiolog::utils::Streamed<T>& arg, fmt::format_context& ctx) const {
+        if (!has_specs_) {
+            return pressiolog::utils::writeStreamed(ctx.out(), arg.value);
+        }
+        fmt::memory_buffer buffer;
+        pressiolog::utils::writeStreamed(fmt::appender(buffer), arg.value);
+        return fmt::formatter<fmt::string_view>::format(
+            fmt::string_view(buffer.data(), buffer.size()), ctx);
+    }
+
+    private:
+        bool has_specs_{false};
+};
+
+#endif // PRESSIOLOG_LOGGER_STREAMED_HPP_
@@ -0,0 +1,175 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// tickclock.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_TICKCLOCK_HPP_
+#define PRESSIOLOG_LOGGER_TICKCLOCK_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+// GCC and Clang read the counter through the builtin behind __rdtsc(), as
+// <x86intrin.h> declares every intrinsic and is slow to compile
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define PRESSIOLOG_RDTSC() __builtin_ia32_rdtsc()
+    #define PRESSIOLOG_HAS_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+    #define PRESSIOLOG_RDTSC() __rdtsc()
+    #define PRESSIOLOG_HAS_TSC 1
+#else
+    #define PRESSIOLOG_HAS_TSC 0
+#endif
+
+namespace pressiolog {
+
+/*
+ * Cheap timestamps for log records.
+ *
+ * Logging threads only read a raw tick count: the CPU's time stamp counter
+ * where available (a few nanoseconds, no system call), and steady_clock
+ * otherwise. calibrate() relates ticks to wall-clock time once; the sinks then
+ * convert the ticks of each record when they write it. While converting, the
+ * tick rate is refined against steady_clock about once per second, so the
+ * error of the short initial calibration does not accumulate.
+ *
+ * now() is thread safe; everything else must be serialized by the caller.
+ */
+class TickClock {
+    public:
+        static std::uint64_t now() {
+            #if PRESSIOLOG_HAS_TSC
+            return PRESSIOLOG_RDTSC();
+            #else
+            return static_cast<std::uint64_t>(steadyNanoseconds_());
+            #endif
+        }
+
+        // Measures the tick rate and records the wall-clock time of "now"
+        void calibrate() {
+            start_wall_ = wallNanoseconds_();
+            start_steady_ = steadyNanoseconds_();
+            start_ticks_ = now();
+            #if PRESSIOLOG_HAS_TSC
+            // Long enough for a usable rate; refine() improves it as time passes
+            std::int64_t steady = start_steady_;
+            std::uint64_t ticks = start_ticks_;
+            while (steady - start_steady_ < 1000000) {
+                steady = steadyNanoseconds_();
+                ticks = now();
+            }
+            ns_per_tick_ = static_cast<double>(steady - start_steady_)
+                         / static_cast<double>(ticks - start_ticks_);
+            #endif
+            anchor_ticks_ = start_ticks_;
+            anchor_ns_ = 0;
+        }
+
+        // Nanoseconds since calibrate()
+        std::int64_t sinceStart(std::uint64_t ticks) {
+            refine_(ticks);
+            const auto delta = static_cast<std::int64_t>(ticks - anchor_ticks_);
+            return anchor_ns_ + static_cast<std::int64_t>(static_cast<double>(delta) * ns_per_tick_);
+        }
+
+        // Nanoseconds since the epoch
+        std::int64_t wallTime(std::uint64_t ticks) {
+            return start_wall_ + sinceStart(ticks);
+        }
+
+        // Converts a difference of tick counts
+        std::int64_t nanoseconds(std::int64_t ticks) const {
+            return static_cast<std::int64_t>(static_cast<double>(ticks) * ns_per_tick_);
+        }
+
+    private:
+        static std::int64_t steadyNanoseconds_() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        static std::int64_t wallNanoseconds_() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        // Re-anchors at the current time and measures the rate over
+        // everything since calibrate()
+        void refine_(std::uint64_t ticks) {
+            #if PRESSIOLOG_HAS_TSC
+            if (static_cast<std::int64_t>(ticks - anchor_ticks_) < refineIntervalTicks_()) {
+                return;
+            }
+            const std::int64_t steady = steadyNanoseconds_() - start_steady_;
+            const std::uint64_t current = now();
+            if (current <= start_ticks_ or steady <= 0) {
+                return;
+            }
+            ns_per_tick_ = static_cast<double>(steady) / static_cast<double>(current - start_ticks_);
+            anchor_ticks_ = current;
+            anchor_ns_ = steady;
+            #else
+            static_cast<void>(ticks);
+            #endif
+        }
+
+        std::int64_t refineIntervalTicks_() const {
+            return static_cast<std::int64_t>(1e9 / ns_per_tick_);
+        }
+
+        std::int64_t start_wall_{0};
+        std::int64_t start_steady_{0};
+        std::uint64_t start_ticks_{0};
+        // Conversion: anchor_ns_ + (ticks - anchor_ticks_) * ns_per_tick_
+        std::uint64_t anchor_ticks_{0};
+        std::int64_t anchor_ns_{0};
+        double ns_per_tick_{1.0};
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_TICKCLOCK_HPP_
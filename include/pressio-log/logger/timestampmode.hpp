@@ -0,0 +1,76 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// timestampmode.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_TIMESTAMPMODE_HPP_
+#define PRESSIOLOG_LOGGER_TIMESTAMPMODE_HPP_
+
+#include <string_view>
+
+namespace pressiolog {
+
+// How text records are timestamped
+enum class TimestampMode : int {
+    none,         // no timestamp (the default)
+    absolute,     // local date and time, e.g. "2025-03-14 15:09:26.535897"
+    since_start,  // seconds since initialization, e.g. "12.345678"
+    delta         // seconds since the previous record, e.g. "+0.000125"
+};
+
+constexpr std::string_view toString(TimestampMode mode) {
+    switch (mode) {
+        case TimestampMode::none:        return "none";
+        case TimestampMode::absolute:    return "absolute";
+        case TimestampMode::since_start: return "since_start";
+        case TimestampMode::delta:       return "delta";
+        default:                         return "unknown";
+    }
+}
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_TIMESTAMPMODE_HPP_
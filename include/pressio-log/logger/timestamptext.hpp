@@ -0,0 +1,123 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// timestamptext.hpp
+//                     		     pressio-log
+//                             Copyright 2025
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef PRESSIOLOG_LOGGER_TIMESTAMPTEXT_HPP_
+#define PRESSIOLOG_LOGGER_TIMESTAMPTEXT_HPP_
+
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include <string_view>
+
+#include <pressio-log/fmt/fmt.h>
+
+namespace pressiolog {
+
+/*
+ * Renders wall-clock times as "YYYY-MM-DD HH:MM:SS.uuuuuu ".
+ *
+ * The text up to the minute is cached: within the same minute, only the
+ * seconds and microseconds are rewritten, which costs a few byte stores
+ * instead of a localtime() call and a format. Local time offsets change on
+ * minute boundaries, so the cached part is valid for the whole minute.
+ *
+ * Not thread safe: the Logger serializes access.
+ */
+class TimestampText {
+    public:
+        // Nanoseconds since the epoch
+        std::string_view format(std::int64_t ns) {
+            std::int64_t seconds = ns / 1000000000;
+            std::int64_t sub_ns = ns % 1000000000;
+            if (sub_ns < 0) {
+                sub_ns += 1000000000;
+                --seconds;
+            }
+            if (seconds < minute_start_ or seconds >= minute_start_ + 60) {
+                formatMinute_(seconds);
+            }
+            writeDigits_(text_ + seconds_offset_, 2, static_cast<std::uint32_t>(seconds - minute_start_));
+            writeDigits_(text_ + seconds_offset_ + 3, 6, static_cast<std::uint32_t>(sub_ns / 1000));
+            return std::string_view(text_, size_);
+        }
+
+    private:
+        static void writeDigits_(char* out, int count, std::uint32_t value) {
+            for (int i = count - 1; i >= 0; --i) {
+                out[i] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+        }
+
+        void formatMinute_(std::int64_t seconds) {
+            const std::time_t time = static_cast<std::time_t>(seconds);
+            std::tm local{};
+            #if defined(_WIN32)
+            localtime_s(&local, &time);
+            #else
+            localtime_r(&time, &local);
+            #endif
+            // tm_sec can be 60 during a leap second
+            minute_start_ = seconds - local.tm_sec;
+            const auto result = fmt::format_to_n(
+                text_, sizeof(text_), "{:04}-{:02}-{:02} {:02}:{:02}:00.000000 ",
+                local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+                local.tm_hour, local.tm_min);
+            size_ = static_cast<std::size_t>(result.out - text_);
+            seconds_offset_ = size_ - 10;
+        }
+
+        std::int64_t minute_start_{std::numeric_limits<std::int64_t>::min() / 2};
+        char text_[40]{};
+        std::size_t size_{0};
+        std::size_t seconds_offset_{0};
+};
+
+} // end namespace pressiolog
+
+#endif // PRESSIOLOG_LOGGER_TIMESTAMPTEXT_HPP_
@@ -51,9 +51,12 @@
 
 #include <pressio-log/fmt/fmt.h>
 
-#include <sstream>
+#include <string>
 #include <type_traits>
 
+#include "formatters.hpp"
+#include "streamed.hpp"
+
 namespace pressiolog { namespace utils {
 
 // If the argument is formattable, return as is to the fmt::format call
@@ -63,20 +66,29 @@ constexpr auto prep_for_fmt(T&& value)
     return std::forward<T>(value);
 }
 
-// If the argument is not formattable, convert to a string and return to the fmt::format call.
-// This is not ideal, since any formatting related to floats/exponents will be incompatible
+// If the argument is not formattable, wrap it so that it is written with operator<<
+// straight into the output (see streamed.hpp). Specifications such as "{:.3e}"
+// are then applied to the resulting text, as for a string.
 template <typename T>
 auto prep_for_fmt(T&& value)
-    -> std::enable_if_t<!fmt::is_formattable<std::decay_t<T>>::value, std::string> {
-    if constexpr (std::is_arithmetic_v<std::decay_t<T>>) {
-        return std::to_string(value);
-    } else {
-        std::ostringstream oss;
-        oss << value;
-        return oss.str();
-    }
+    -> std::enable_if_t<!fmt::is_formattable<std::decay_t<T>>::value, Streamed<std::decay_t<T>>> {
+    return Streamed<std::decay_t<T>>{value};
 }
 
+// The type that prep_for_fmt() passes to fmt for an argument of type T,
+// spelled the way fmt deduces it (lvalues stay references, rvalues decay)
+template <typename T>
+using fmt_arg_t = std::conditional_t<
+    std::is_lvalue_reference_v<decltype(prep_for_fmt(std::declval<T>()))>,
+    decltype(prep_for_fmt(std::declval<T>())),
+    std::remove_reference_t<decltype(prep_for_fmt(std::declval<T>()))>>;
+
+// Format string checked against the arguments as they will be passed to fmt.
+// With C++20, fmt validates string literals at compile time; dynamic strings
+// must be wrapped in fmt::runtime().
+template <typename... Args>
+using format_string = fmt::format_string<fmt_arg_t<Args>...>;
+
 }} // end namespace pressiolog::utils
 
 #endif // PRESSIOLOG_LOGGER_UTILS_HPP_
\ No newline at end of file
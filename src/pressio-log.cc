@@ -0,0 +1,40 @@
+// The compiled pressio-log library (pressio-log::compiled).
+//
+// Builds the Logger's non-template member functions and the bundled fmt once,
+// instead of in every translation unit that includes <pressio-log/core.hpp>.
+// Only the logging templates (logger_templates.hpp) and fmt's formatting
+// templates are still instantiated by the users of the library.
+
+#include <pressio-log/logger/logger_impl.hpp>
+
+#if !PRESSIO_ENABLE_EXTERNAL_FMT
+
+#include <pressio-log/fmt/format-inl.h>
+
+// The explicit instantiations that fmt's own src/format.cc provides. The
+// headers declare them extern when FMT_HEADER_ONLY is not defined.
+FMT_BEGIN_NAMESPACE
+namespace detail {
+
+template FMT_API auto dragonbox::to_decimal(float x) noexcept -> dragonbox::decimal_fp<float>;
+template FMT_API auto dragonbox::to_decimal(double x) noexcept -> dragonbox::decimal_fp<double>;
+
+#if FMT_USE_LOCALE
+template FMT_API locale_ref::locale_ref(const std::locale& loc);
+template FMT_API auto locale_ref::get<std::locale>() const -> std::locale;
+#endif
+
+template FMT_API auto thousands_sep_impl(locale_ref) -> thousands_sep_result<char>;
+template FMT_API auto decimal_point_impl(locale_ref) -> char;
+template FMT_API void buffer<char>::append(const char*, const char*);
+template FMT_API void vformat_to(buffer<char>&, string_view,
+                                 typename vformat_args<>::type, locale_ref);
+
+template FMT_API auto thousands_sep_impl(locale_ref) -> thousands_sep_result<wchar_t>;
+template FMT_API auto decimal_point_impl(locale_ref) -> wchar_t;
+template FMT_API void buffer<wchar_t>::append(const wchar_t*, const wchar_t*);
+
+} // end namespace detail
+FMT_END_NAMESPACE
+
+#endif
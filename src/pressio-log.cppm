@@ -0,0 +1,83 @@
+// The pressio.log C++20 module (pressio-log::module).
+//
+// Exports the Logger, its settings, and fmt's formatting entry points. The
+// headers, including the bundled fmt, are parsed once when the module is
+// built, instead of in every translation unit that logs. Modules cannot
+// export macros: translation units that import the module get the logging
+// macros from <pressio-log/module.hpp>.
+
+module;
+
+#include <pressio-log/core.hpp>
+
+export module pressio.log;
+
+export namespace pressiolog {
+
+using pressiolog::Logger;
+using pressiolog::LogLevel;
+using pressiolog::LogTo;
+using pressiolog::LogMode;
+using pressiolog::FileFormat;
+using pressiolog::TimestampMode;
+using pressiolog::FlushPolicy;
+using pressiolog::OnOverflow;
+using pressiolog::OverflowPolicy;
+using pressiolog::Callsite;
+using pressiolog::CallsiteState;
+using pressiolog::CallsiteInfo;
+using pressiolog::operator<<;
+using pressiolog::toString;
+using pressiolog::RangeOptions;
+using pressiolog::MatrixLayout;
+using pressiolog::RangeView;
+using pressiolog::MatrixView;
+using pressiolog::range;
+using pressiolog::matrix;
+
+namespace ratelimit {
+using pressiolog::ratelimit::Counter;
+using pressiolog::ratelimit::Interval;
+} // end namespace ratelimit
+
+// Used by the logging macros (module.hpp)
+namespace frontend {
+using pressiolog::frontend::logFromMacro;
+using pressiolog::frontend::Erased;
+using pressiolog::frontend::Typed;
+using pressiolog::frontend::FormatString;
+using pressiolog::frontend::CheckedFormat;
+} // end namespace frontend
+
+namespace colors {
+using pressiolog::colors::green;
+using pressiolog::colors::red;
+using pressiolog::colors::yellow;
+using pressiolog::colors::reset;
+using pressiolog::colors::when;
+} // end namespace colors
+
+} // end namespace pressiolog
+
+export namespace fmt {
+
+using fmt::format;
+using fmt::format_to;
+using fmt::format_to_n;
+using fmt::formatted_size;
+using fmt::vformat;
+using fmt::vformat_to;
+using fmt::runtime;
+using fmt::to_string;
+using fmt::format_string;
+using fmt::format_error;
+using fmt::formatter;
+using fmt::format_context;
+using fmt::format_args;
+using fmt::make_format_args;
+using fmt::basic_memory_buffer;
+using fmt::memory_buffer;
+using fmt::appender;
+using fmt::string_view;
+
+} // end namespace fmt
@@ -30,3 +30,19 @@ macro(add_mpi_exe_and_test TESTNAME PKGNAME TESTSRCS nRANKS REGEXOK)
   )
 endmacro()
 #=====================================================================
+
+# Adds a test that compiles SOURCE with the given C++ standard and compile
+# definitions (ARGN), and passes if the compiler rejects it. The object
+# library is not part of the default build.
+macro(add_compile_fail_test TESTNAME SOURCE STANDARD)
+  add_library(${TESTNAME} OBJECT EXCLUDE_FROM_ALL ${SOURCE})
+  target_include_directories(${TESTNAME} PRIVATE ${CMAKE_SOURCE_DIR}/include)
+  target_compile_definitions(${TESTNAME} PRIVATE ${ARGN})
+  set_target_properties(${TESTNAME} PROPERTIES CXX_STANDARD ${STANDARD})
+  add_test(
+    NAME ${TESTNAME}
+    COMMAND ${CMAKE_COMMAND} --build ${CMAKE_BINARY_DIR} --target ${TESTNAME} --config $<CONFIG>
+    )
+  set_tests_properties(${TESTNAME} PROPERTIES WILL_FAIL TRUE RUN_SERIAL TRUE)
+endmacro()
+#=====================================================================
@@ -1,13 +1,29 @@
 #include <gtest/gtest.h>
+#include <cstddef>
 #include "pressio-log/core.hpp"
 
-class LoggerTest : public ::testing::Test {
+// Initializes the logger at the given level and mode (and, if not 0, with the
+// given asynchronous queue capacity) before each test, and finalizes it after
+template <pressiolog::LogLevel Level,
+          pressiolog::LogMode Mode = pressiolog::LogMode::sync,
+          std::size_t QueueCapacity = 0>
+class LoggerTestWith : public ::testing::Test {
 protected:
     void SetUp() override {
-        PRESSIOLOG_INITIALIZE();
+        if (QueueCapacity > 0) {
+            PRESSIOLOG_SET_ASYNC_QUEUE_CAPACITY(QueueCapacity);
+        }
+        #if PRESSIO_ENABLE_TPL_MPI
+        PRESSIOLOG_INITIALIZE(Level, pressiolog::LogTo::console, "pressio.log", 0, MPI_COMM_WORLD, Mode);
+        #else
+        PRESSIOLOG_INITIALIZE(Level, pressiolog::LogTo::console, "pressio.log", Mode);
+        #endif
     }
 
     void TearDown() override {
+        PRESSIOLOG_RESET_CALLSITES();
         PRESSIOLOG_FINALIZE();
     }
 };
+
+using LoggerTest = LoggerTestWith<pressiolog::LogLevel::sparse>;
@@ -0,0 +1,29 @@
+// Format strings that the logging macros must reject at compile time (see
+// add_compile_fail_test). With no case defined, this file compiles.
+
+#include <string>
+
+#if PRESSIOLOG_TEST_MACROS_ONLY
+#include "pressio-log/macros.hpp"
+#else
+#include "pressio-log/core.hpp"
+#endif
+
+void logFormats(const std::string& dynamic) {
+    PRESSIOLOG_INFO("Valid {:>5} {}", 1, dynamic);
+    #if !PRESSIOLOG_TEST_MACROS_ONLY
+    PRESSIOLOG_INFO(fmt::runtime(dynamic), 1);
+    #endif
+
+    #if defined(PRESSIOLOG_TEST_BAD_SPEC)
+    PRESSIOLOG_INFO("Bad spec {:q}", 1);
+    #elif defined(PRESSIOLOG_TEST_MISSING_ARGUMENT)
+    PRESSIOLOG_INFO("Missing argument {} {}", 1);
+    #elif defined(PRESSIOLOG_TEST_STRING_FORMAT)
+    // Dynamic format strings must be passed through fmt::runtime()
+    PRESSIOLOG_INFO(dynamic, 1);
+    #elif defined(PRESSIOLOG_TEST_ARRAY_FORMAT)
+    char format[] = "Array {}";
+    PRESSIOLOG_INFO(format, 1);
+    #endif
+}
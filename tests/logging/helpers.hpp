@@ -36,3 +36,19 @@ std::string read_file(std::string fileName) {
     oss << file.rdbuf();
     return oss.str();
 }
+
+// Helper to count the lines of the output that contain str
+int count_lines(const std::string& output, const std::string& str) {
+    int count = 0;
+    std::istringstream stream(output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        count += line.find(str) != std::string::npos;
+    }
+    return count;
+}
+
+// Helper to check whether a logging macro evaluated its arguments
+int count_evaluations(int& counter) {
+    return ++counter;
+}
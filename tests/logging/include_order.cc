@@ -0,0 +1,9 @@
+// Includes macros_template.hpp before core.hpp (see test_logger_include_order.cc)
+
+#include "macros_template.hpp"
+#include "pressio-log/core.hpp"
+
+void logBeforeCore(int i) {
+    logValue("before level", pressiolog::LogLevel::info);
+    logValue("before count", i);
+}
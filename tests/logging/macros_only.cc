@@ -0,0 +1,30 @@
+// Logs through the lightweight macros.hpp only (see test_logger_macros.cc)
+
+#include <string>
+#include <string_view>
+
+#include "pressio-log/macros.hpp"
+
+// The point of macros.hpp is to leave these out
+#ifdef FMT_VERSION
+#error "macros.hpp includes fmt"
+#endif
+#if defined(_GLIBCXX_IOSTREAM) || defined(_LIBCPP_IOSTREAM)
+#error "macros.hpp includes <iostream>"
+#endif
+#if defined(_GLIBCXX_FILESYSTEM) || defined(_LIBCPP_FILESYSTEM)
+#error "macros.hpp includes <filesystem>"
+#endif
+
+void lightLogAll(int i) {
+    const std::string name = "solver";
+    PRESSIOLOG_SPARSE("light sparse {} {:.2f} {} {}", i, 2.5, name, std::string_view("view"));
+    PRESSIOLOG_INFO("light info {}", i);
+    PRESSIOLOG_DEBUG("light debug {}", i);
+    PRESSIOLOG_SPARSE("light message {} kept as is");
+    PRESSIOLOG_INFO_CH("light.channel", "light channel {}", i);
+}
+
+void lightLogOnce(int i) {
+    PRESSIOLOG_SPARSE_ONCE("light once {}", i);
+}
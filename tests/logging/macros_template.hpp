@@ -0,0 +1,14 @@
+// A header that only includes macros.hpp, like a library header that logs.
+// include_order.cc includes it before core.hpp, and
+// test_logger_include_order.cc after it: the macros must expand the same way.
+
+#include <string>
+
+#include "pressio-log/macros.hpp"
+
+// Numbers and strings are packed; other types (here LogLevel) are formatted
+// by the Logger, which is defined where this is instantiated
+template <typename T>
+void logValue(const std::string& name, const T& value) {
+    PRESSIOLOG_SPARSE("{} = {}", name, value);
+}
@@ -0,0 +1,37 @@
+#define PRESSIOLOG_ACTIVE_LEVEL PRESSIOLOG_LEVEL_INFO
+
+#include <gtest/gtest.h>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/core.hpp"
+
+void runTest() {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+
+    CoutRedirector redirect;
+
+    int evaluations = 0;
+    PRESSIOLOG_SPARSE("Sparse {}", count_evaluations(evaluations));
+    PRESSIOLOG_INFO("Info {}", count_evaluations(evaluations));
+    PRESSIOLOG_DEBUG("Debug {}", count_evaluations(evaluations));
+    LOG(pressiolog::LogLevel::debug, "Generic debug {}", count_evaluations(evaluations));
+    PRESSIOLOG_INFO_ONCE("Info once {}", count_evaluations(evaluations));
+    PRESSIOLOG_DEBUG_EVERY_N(1, "Debug every {}", count_evaluations(evaluations));
+
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "Sparse 1",      true));
+    EXPECT_TRUE(check_output(output, "Info 2",        true));
+    EXPECT_TRUE(check_output(output, "Debug",         false));
+    EXPECT_TRUE(check_output(output, "Generic debug", false));
+    EXPECT_TRUE(check_output(output, "Info once 3",   true));
+    EXPECT_TRUE(check_output(output, "Debug every",   false));
+
+    // Arguments of compiled-out messages must not be evaluated
+    EXPECT_EQ(evaluations, 3);
+}
+
+TEST_F(LoggerTest, Serial_ActiveLevel_Info) {
+    runTest();
+}
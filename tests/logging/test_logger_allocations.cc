@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <streambuf>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/core.hpp"
+
+// Count every heap allocation made while counting is enabled
+static std::atomic<bool> count_allocations{false};
+static std::atomic<int> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    if (count_allocations) {
+        ++allocation_count;
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Stream buffer that discards its output without allocating
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// Only printable with operator<<
+struct Vec3 {
+    double x, y, z;
+};
+
+std::ostream& operator<<(std::ostream& os, const Vec3& v) {
+    return os << "(" << v.x << ", " << v.y << ", " << v.z << ")";
+}
+
+void logTypicalMessages() {
+    const std::string name = "newton";
+    PRESSIOLOG_SPARSE("Iteration {:>4}: residual = {:.6e}", 12, 3.25e-8);
+    PRESSIOLOG_INFO("Solver {} converged in {} steps", name, 12);
+    PRESSIOLOG_DEBUG("Plain message");
+    PRESSIOLOG_WARNING("Step size {} is small", 1e-12);
+    PRESSIOLOG_ERROR("Solver {} failed", "gmres");
+}
+
+TEST_F(LoggerTest, Serial_NoAllocationsPerMessage) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    NullBuffer null_buffer;
+    auto old_buffer = std::cout.rdbuf(&null_buffer);
+
+    // The first messages may grow the thread-local buffer
+    logTypicalMessages();
+
+    count_allocations = true;
+    for (int i = 0; i < 100; ++i) {
+        logTypicalMessages();
+    }
+    count_allocations = false;
+
+    std::cout.rdbuf(old_buffer);
+
+    EXPECT_EQ(allocation_count.load(), 0);
+}
+
+TEST_F(LoggerTest, Serial_NoAllocationsStreamedArguments) {
+    // Enums are formatted natively, and other types are streamed straight
+    // into the message
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    NullBuffer null_buffer;
+    auto old_buffer = std::cout.rdbuf(&null_buffer);
+
+    auto logStreamed = []() {
+        PRESSIOLOG_INFO("Level {}, position {}", pressiolog::LogLevel::info, Vec3{1.0, 2.5, -3.0});
+        PRESSIOLOG_INFO("Padded {:>30}", Vec3{0.125, 0.0, 1e-9});
+    };
+    logStreamed();
+
+    count_allocations = true;
+    for (int i = 0; i < 100; ++i) {
+        logStreamed();
+    }
+    count_allocations = false;
+
+    std::cout.rdbuf(old_buffer);
+
+    EXPECT_EQ(allocation_count.load(), 0);
+}
+
+TEST_F(LoggerTest, Serial_NoAllocationsRanges) {
+    // Ranges and matrices are formatted straight into the message
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    NullBuffer null_buffer;
+    auto old_buffer = std::cout.rdbuf(&null_buffer);
+
+    const std::vector<double> state(100000, 0.5);
+    pressiolog::RangeOptions options;
+    options.stats = true;
+    auto logRanges = [&]() {
+        PRESSIOLOG_INFO("State {:.3e}", pressiolog::range(state, options));
+        PRESSIOLOG_INFO("Block {}", pressiolog::matrix(state.data(), 100, 1000,
+                                                      pressiolog::MatrixLayout::col_major));
+    };
+    logRanges();
+
+    count_allocations = true;
+    for (int i = 0; i < 100; ++i) {
+        logRanges();
+    }
+    count_allocations = false;
+
+    std::cout.rdbuf(old_buffer);
+
+    EXPECT_EQ(allocation_count.load(), 0);
+}
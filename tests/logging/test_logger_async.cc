@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/logger/binarylog.hpp"
+
+// A small queue makes producers wrap around and wait on the worker
+using AsyncLoggerTest = LoggerTestWith<pressiolog::LogLevel::debug, pressiolog::LogMode::async, 16>;
+
+void logFromThreads(int num_threads, int num_messages) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([t, num_messages]() {
+            for (int i = 0; i < num_messages; ++i) {
+                PRESSIOLOG_INFO("Thread {} message {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_Console) {
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    CoutRedirector redirect;
+
+    logFromThreads(4, 500);
+    PRESSIOLOG_ERROR("Last");
+
+    // Finalizing drains the queue
+    PRESSIOLOG_FINALIZE();
+    std::string output = redirect.str();
+
+    EXPECT_EQ(count_lines(output, "message"), 4 * 500);
+    EXPECT_EQ(count_lines(output, "Thread 2 message 499"), 1);
+    EXPECT_TRUE(check_output(output, "ERROR: Last", true));
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_WakesAfterIdle) {
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    CoutRedirector redirect;
+
+    // The worker parks while the queue stays empty; each push wakes it up
+    for (int i = 0; i < 3; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        PRESSIOLOG_INFO("After idle {}", i);
+        PRESSIOLOG_FLUSH();
+        EXPECT_EQ(count_lines(redirect.str(), "After idle"), i + 1);
+    }
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_File) {
+    const std::string fileName = "async_pressio.log";
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+
+    logFromThreads(2, 100);
+
+    PRESSIOLOG_FLUSH();
+    auto output = read_file(fileName);
+    EXPECT_EQ(count_lines(output, "message"), 2 * 100);
+
+    PRESSIOLOG_SET_OUTPUT_FILENAME("pressio.log");
+    std::filesystem::remove(fileName);
+}
+
+// Stream buffer that holds the writing thread until it is opened,
+// so the background thread stalls and the queue fills up
+class GatedBuffer : public std::streambuf {
+public:
+    void open() { open_.store(true); }
+    bool waiting() const { return waiting_.load(); }
+    std::string str() const { return text_; }
+
+protected:
+    int_type overflow(int_type ch) override {
+        wait_();
+        if (ch != traits_type::eof()) text_.push_back(static_cast<char>(ch));
+        return ch;
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        wait_();
+        text_.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+
+private:
+    void wait_() {
+        while (!open_.load()) {
+            waiting_.store(true);
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<bool> open_{false};
+    std::atomic<bool> waiting_{false};
+    std::string text_;
+};
+
+// Fills the queue (capacity 16) behind a stalled worker, then logs 100 more
+// info messages and one error, and returns the console output
+std::string overflowQueue(const pressiolog::OverflowPolicy& policy) {
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+    PRESSIOLOG_SET_OVERFLOW_POLICY(policy);
+    PRESSIOLOG_FLUSH();
+    GatedBuffer gated;
+    auto* old_buf = std::cout.rdbuf(&gated);
+
+    PRESSIOLOG_INFO("Stalled");
+    while (!gated.waiting()) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 100; ++i) {
+        PRESSIOLOG_INFO("Overflow message {}", i);
+    }
+    // Errors are never dropped: this waits until the worker makes room
+    std::thread error_thread([]() { PRESSIOLOG_ERROR("Kept"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    gated.open();
+    error_thread.join();
+    PRESSIOLOG_FLUSH();
+
+    std::cout.rdbuf(old_buf);
+    PRESSIOLOG_SET_OVERFLOW_POLICY(pressiolog::OverflowPolicy::block());
+    return gated.str();
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_DropNewest) {
+    auto output = overflowQueue(pressiolog::OverflowPolicy::dropNewest());
+    auto& logger = pressiolog::Logger::instance();
+
+    EXPECT_EQ(count_lines(output, "Overflow message"), 16);
+    EXPECT_EQ(logger.droppedRecords(pressiolog::LogLevel::info), 84u);
+    EXPECT_EQ(logger.droppedRecords(pressiolog::LogLevel::error), 0u);
+    EXPECT_TRUE(check_output(output, "Overflow message 0", true));
+    EXPECT_TRUE(check_output(output, "Overflow message 99", false));
+    EXPECT_TRUE(check_output(output, "ERROR: Kept", true));
+
+    // The drop counts are reported (and reset) when finalizing
+    CoutRedirector redirect;
+    PRESSIOLOG_FINALIZE();
+    EXPECT_TRUE(check_output(redirect.str(), "dropped 84 records because the queue was full (info: 84)", true));
+    EXPECT_EQ(logger.droppedRecords(pressiolog::LogLevel::info), 0u);
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_DropOldest) {
+    auto output = overflowQueue(pressiolog::OverflowPolicy::dropOldest());
+    auto& logger = pressiolog::Logger::instance();
+
+    EXPECT_EQ(logger.droppedRecords(pressiolog::LogLevel::info), 85u);
+    EXPECT_EQ(count_lines(output, "Overflow message"), 15);
+    EXPECT_TRUE(check_output(output, "Overflow message 0\n", false));
+    EXPECT_TRUE(check_output(output, "Overflow message 99", true));
+    EXPECT_TRUE(check_output(output, "ERROR: Kept", true));
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_KeepLevel) {
+    // Warnings are kept along with errors and sparse messages
+    auto output = overflowQueue(pressiolog::OverflowPolicy::dropNewest(pressiolog::LogLevel::warning));
+    EXPECT_EQ(pressiolog::Logger::instance().droppedRecords(pressiolog::LogLevel::info), 84u);
+
+    EXPECT_FALSE(pressiolog::OverflowPolicy::dropNewest(pressiolog::LogLevel::warning).mayDrop(pressiolog::LogLevel::warning));
+    EXPECT_TRUE(pressiolog::OverflowPolicy::dropNewest(pressiolog::LogLevel::warning).mayDrop(pressiolog::LogLevel::info));
+    // error is kept even if a less important keep level is requested
+    EXPECT_FALSE(pressiolog::OverflowPolicy::dropOldest(pressiolog::LogLevel::none).mayDrop(pressiolog::LogLevel::error));
+    EXPECT_FALSE(pressiolog::OverflowPolicy::block().mayDrop(pressiolog::LogLevel::debug));
+}
+
+TEST_F(AsyncLoggerTest, Serial_Async_BinaryCallsiteIds) {
+    // Records written by the background thread keep their Callsite id, so the
+    // binary dictionary holds one entry per logging macro, even for two
+    // macros with the same format string
+    const std::string fileName = "async_binary.log";
+    std::filesystem::remove(fileName);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+    for (int i = 0; i < 100; ++i) {
+        PRESSIOLOG_INFO("Shared format {}", i);
+        PRESSIOLOG_INFO("Shared format {}", -i);
+    }
+    PRESSIOLOG_FLUSH();
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+    PRESSIOLOG_SET_OUTPUT_FILENAME("pressio.log");
+
+    const std::string data = read_file(fileName);
+    const std::string format = "Shared format {}";
+    int entries = 0;
+    for (auto pos = data.find(format); pos != std::string::npos; pos = data.find(format, pos + 1)) {
+        ++entries;
+    }
+    EXPECT_EQ(entries, 2);
+    std::ostringstream output;
+    pressiolog::binlog::decode(data, output);
+    EXPECT_EQ(count_lines(output.str(), "Shared format"), 2 * 100);
+    EXPECT_TRUE(check_output(output.str(), "Shared format -99", true));
+
+    std::filesystem::remove(fileName);
+}
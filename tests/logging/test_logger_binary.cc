@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/core.hpp"
+#include "pressio-log/logger/binarylog.hpp"
+
+struct Streamable {
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& s) {
+    return os << "Streamable(" << s.value << ")";
+}
+
+// Logs the same messages to the given file in the given format
+void logMessages(const std::string& fileName, pressiolog::FileFormat format) {
+    std::filesystem::remove(fileName);
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+    PRESSIOLOG_SET_FILE_FORMAT(format);
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+
+    std::string name = "solver";
+    std::string fmt_str = "runtime {}";
+    for (int i = 0; i < 3; ++i) {
+        PRESSIOLOG_DEBUG("Iteration {} of {}: residual {:.6e}", i, name, 1.0 / (i + 1));
+    }
+    PRESSIOLOG_SPARSE("Sparse");
+    PRESSIOLOG_INFO("misc: {} {} {} {:>5}", true, 'c', -42LL, 7u);
+    PRESSIOLOG_WARNING("Warning {}", 1);
+    PRESSIOLOG_ERROR("Error {}", 2.5f);
+    PRESSIOLOG_INFO("Object: {}", Streamable{3});
+    PRESSIOLOG_INFO(fmt::runtime(fmt_str), 1);
+    fmt_str = "changed {}";
+    PRESSIOLOG_INFO(fmt::runtime(fmt_str), 2);
+    // A format string that changes between calls of the same macro
+    for (const std::string loop_fmt : {"loop {}", "loop changed {}"}) {
+        PRESSIOLOG_INFO(fmt::runtime(loop_fmt), 3);
+    }
+    PRESSIOLOG_FLUSH();
+}
+
+std::string decode(const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    const std::string data(std::istreambuf_iterator<char>(file), {});
+    std::ostringstream output;
+    pressiolog::binlog::decode(data, output);
+    return output.str();
+}
+
+TEST_F(LoggerTest, Serial_Binary_RoundTrip) {
+    logMessages("binary_text.log", pressiolog::FileFormat::text);
+    logMessages("binary_binary.log", pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+
+    const auto expected = read_file("binary_text.log");
+    EXPECT_TRUE(check_output(expected, "Object: Streamable(3)", true));
+    EXPECT_TRUE(check_output(expected, "changed 2", true));
+    EXPECT_TRUE(check_output(expected, "loop changed 3", true));
+    EXPECT_EQ(decode("binary_binary.log"), expected);
+
+    std::filesystem::remove("binary_text.log");
+    std::filesystem::remove("binary_binary.log");
+}
+
+TEST_F(LoggerTest, Serial_Binary_Smaller) {
+    const std::string textName = "binary_size_text.log";
+    const std::string binaryName = "binary_size_binary.log";
+    auto run = [](const std::string& fileName, pressiolog::FileFormat format) {
+        std::filesystem::remove(fileName);
+        PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+        PRESSIOLOG_SET_FILE_FORMAT(format);
+        PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+        for (int i = 0; i < 1000; ++i) {
+            PRESSIOLOG_SPARSE("Newton iteration {} converged after {} line search steps", i, 3);
+        }
+        PRESSIOLOG_FLUSH();
+    };
+    run(textName, pressiolog::FileFormat::text);
+    run(binaryName, pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+
+    const auto textSize = std::filesystem::file_size(textName);
+    const auto binarySize = std::filesystem::file_size(binaryName);
+    EXPECT_LT(binarySize * 3, textSize);
+    EXPECT_EQ(decode(binaryName), read_file(textName));
+
+    std::filesystem::remove(textName);
+    std::filesystem::remove(binaryName);
+}
+
+TEST_F(LoggerTest, Serial_Binary_Sessions) {
+    // Each time the file is reopened, a new session (with its own callsite
+    // ids) is appended
+    const std::string fileName = "binary_sessions.log";
+    std::filesystem::remove(fileName);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+
+    PRESSIOLOG_SPARSE("First {}", 1);
+    PRESSIOLOG_FINALIZE();
+    PRESSIOLOG_SPARSE("Second {}", 2);
+    PRESSIOLOG_SPARSE("First {}", 3);
+    PRESSIOLOG_FLUSH();
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+
+    const auto output = decode(fileName);
+    EXPECT_TRUE(check_output(output, "First 1", true));
+    EXPECT_TRUE(check_output(output, "Second 2", true));
+    EXPECT_TRUE(check_output(output, "First 3", true));
+    EXPECT_LT(output.find("Second 2"), output.find("First 3"));
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(LoggerTest, Serial_Binary_Malformed) {
+    std::ostringstream output;
+    EXPECT_THROW(pressiolog::binlog::decode("not a binary log", output), std::runtime_error);
+
+    const std::string fileName = "binary_truncated.log";
+    std::filesystem::remove(fileName);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+    PRESSIOLOG_SPARSE("Value {}", 1.5);
+    PRESSIOLOG_FLUSH();
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::string data(std::istreambuf_iterator<char>(file), {});
+    data.pop_back();
+    EXPECT_THROW(pressiolog::binlog::decode(data, output), std::runtime_error);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(LoggerTest, Serial_Binary_OtherHost) {
+    // The packed arguments are raw host bytes, so a file from a host with
+    // another layout (here, 4-byte pointers) is rejected
+    pressiolog::binlog::Encoder encoder;
+    std::string data;
+    std::string packed;
+    pressiolog::argpack::packAll(packed, 7);
+    encoder.message(data, pressiolog::LogLevel::warning, 0, 0,
+                    pressiolog::binlog::no_callsite, "Value {}", packed);
+    std::ostringstream output;
+    EXPECT_NO_THROW(pressiolog::binlog::decode(data, output));
+
+    // Kind, magic, version, flags, byte order, and size of bool precede it
+    const std::size_t pointer_size = 1 + pressiolog::binlog::magic.size() + 2 + 2;
+    data[pointer_size] = static_cast<char>(sizeof(void*) == 4 ? 8 : 4);
+    EXPECT_THROW(pressiolog::binlog::decode(data, output), std::runtime_error);
+}
+
+TEST_F(LoggerTest, Serial_Binary_CallsiteIds) {
+    // Messages with a callsite id share its callsite record; the others are
+    // matched by format string
+    pressiolog::binlog::Encoder encoder;
+    std::string data;
+    std::string packed;
+    pressiolog::argpack::packAll(packed, 7);
+    encoder.message(data, pressiolog::LogLevel::warning, 0, 0, 3, "Value {}", packed);
+    const auto first_size = data.size();
+    encoder.message(data, pressiolog::LogLevel::warning, 0, 0, 3, "Value {}", packed);
+    // Kind, callsite id, time delta, rank, and the arguments
+    EXPECT_EQ(data.size() - first_size, 4 + packed.size());
+    encoder.message(data, pressiolog::LogLevel::warning, 0, 0,
+                    pressiolog::binlog::no_callsite, "Other {}", packed);
+    encoder.message(data, pressiolog::LogLevel::info, 0, 0, 3, "Value {}", packed);
+
+    std::ostringstream output;
+    pressiolog::binlog::decode(data, output);
+    EXPECT_EQ(output.str(),
+              "[0] WARNING: Value 7\n[0] WARNING: Value 7\n[0] WARNING: Other 7\n[0] Value 7\n");
+}
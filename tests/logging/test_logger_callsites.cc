@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+
+using CallsiteLoggerTest = LoggerTestWith<pressiolog::LogLevel::info>;
+
+// Each function holds its own callsites, so tests do not share them
+
+void solverStep(int i) {
+    PRESSIOLOG_DEBUG("solver debug {}", i);
+    PRESSIOLOG_INFO("solver info {}", i);
+}
+
+void assemblyStep(int i) {
+    PRESSIOLOG_DEBUG("assembly debug {}", i);
+}
+
+const pressiolog::CallsiteInfo* findCallsite(
+    const std::vector<pressiolog::CallsiteInfo>& callsites, const std::string& format) {
+    for (const auto& callsite : callsites) {
+        if (std::string(callsite.format) == format) {
+            return &callsite;
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_List) {
+    CoutRedirector redirect;
+    solverStep(0);
+
+    const auto callsites = PRESSIOLOG_CALLSITES();
+    const auto* debug = findCallsite(callsites, "\"solver debug {}\"");
+    const auto* info  = findCallsite(callsites, "\"solver info {}\"");
+    ASSERT_NE(debug, nullptr);
+    ASSERT_NE(info, nullptr);
+
+    EXPECT_EQ(debug->level, pressiolog::LogLevel::debug);
+    EXPECT_TRUE(check_output(debug->file, "test_logger_callsites.cc", true));
+    EXPECT_EQ(std::string(debug->function), "solverStep");
+    EXPECT_EQ(info->line, debug->line + 1);
+    EXPECT_EQ(debug->state, pressiolog::CallsiteState::level);
+    EXPECT_FALSE(debug->enabled);
+    EXPECT_TRUE(info->enabled);
+
+    // Ids index the list
+    for (std::size_t i = 0; i < callsites.size(); ++i) {
+        EXPECT_EQ(callsites[i].id, i);
+    }
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_EnableByPattern) {
+    CoutRedirector redirect;
+    solverStep(1);
+    assemblyStep(1);
+
+    // Turn on debug output for one function only
+    EXPECT_EQ(PRESSIOLOG_ENABLE_CALLSITES("solverStep"), 2);
+    solverStep(2);
+    assemblyStep(2);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "solver debug 1",   false));
+    EXPECT_TRUE(check_output(output, "solver debug 2",   true));
+    EXPECT_TRUE(check_output(output, "solver info 2",    true));
+    EXPECT_TRUE(check_output(output, "assembly debug",   false));
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_FileLinePattern) {
+    CoutRedirector redirect;
+    solverStep(0);
+
+    const auto callsites = PRESSIOLOG_CALLSITES();
+    const auto* info = findCallsite(callsites, "\"solver info {}\"");
+    ASSERT_NE(info, nullptr);
+
+    EXPECT_EQ(PRESSIOLOG_DISABLE_CALLSITES("*callsites.cc:" + std::to_string(info->line)), 1);
+    solverStep(3);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "solver info 0", true));
+    EXPECT_TRUE(check_output(output, "solver info 3", false));
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_ById) {
+    CoutRedirector redirect;
+    assemblyStep(0);
+
+    const auto* debug = findCallsite(PRESSIOLOG_CALLSITES(), "\"assembly debug {}\"");
+    ASSERT_NE(debug, nullptr);
+    const auto id = debug->id;
+
+    EXPECT_TRUE(PRESSIOLOG_SET_CALLSITE_STATE(id, pressiolog::CallsiteState::enabled));
+    assemblyStep(1);
+    EXPECT_TRUE(PRESSIOLOG_CALLSITES()[id].enabled);
+
+    EXPECT_TRUE(PRESSIOLOG_SET_CALLSITE_STATE(id, pressiolog::CallsiteState::level));
+    assemblyStep(2);
+
+    EXPECT_FALSE(PRESSIOLOG_SET_CALLSITE_STATE(1u << 30, pressiolog::CallsiteState::enabled));
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "assembly debug 0", false));
+    EXPECT_TRUE(check_output(output, "assembly debug 1", true));
+    EXPECT_TRUE(check_output(output, "assembly debug 2", false));
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_FutureCallsites) {
+    CoutRedirector redirect;
+
+    // Patterns apply to callsites that have not run yet
+    PRESSIOLOG_ENABLE_CALLSITES("futureStep");
+    auto futureStep = [](int i) { PRESSIOLOG_DEBUG("future debug {}", i); };
+    futureStep(0);
+
+    PRESSIOLOG_RESET_CALLSITES();
+    futureStep(1);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "future debug 0", false));
+    EXPECT_TRUE(check_output(output, "future debug 1", false));
+
+    // A lambda's callsite reports operator() as its function
+    PRESSIOLOG_ENABLE_CALLSITES("operator()");
+    futureStep(2);
+    output = redirect.str();
+    EXPECT_TRUE(check_output(output, "future debug 2", true));
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_FollowLevel) {
+    CoutRedirector redirect;
+    solverStep(0);
+    PRESSIOLOG_DISABLE_CALLSITES("solverStep");
+
+    // Changing the level updates callsites that follow it, but not overrides
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    solverStep(1);
+    assemblyStep(1);
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::info);
+    assemblyStep(2);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "solver info 1",    false));
+    EXPECT_TRUE(check_output(output, "assembly debug 1", true));
+    EXPECT_TRUE(check_output(output, "assembly debug 2", false));
+}
+
+void logAtLevel(pressiolog::LogLevel level, int i) {
+    LOG(level, "runtime level {}", i);
+}
+
+TEST_F(CallsiteLoggerTest, Serial_Callsites_RuntimeLevel) {
+    CoutRedirector redirect;
+    logAtLevel(pressiolog::LogLevel::debug, 0);
+    logAtLevel(pressiolog::LogLevel::info, 1);
+
+    // Each call is filtered at its own level...
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "runtime level 0", false));
+    EXPECT_TRUE(check_output(output, "runtime level 1", true));
+
+    // ... but the callsite reports the level of its first call
+    const auto callsites = PRESSIOLOG_CALLSITES();
+    const auto* callsite = findCallsite(callsites, "\"runtime level {}\"");
+    ASSERT_NE(callsite, nullptr);
+    EXPECT_EQ(callsite->level, pressiolog::LogLevel::debug);
+}
+
+TEST(CallsiteMatch, Serial_Callsites_Glob) {
+    using pressiolog::detail::globMatch;
+    EXPECT_TRUE(globMatch("*", ""));
+    EXPECT_TRUE(globMatch("*/solvers/*", "src/solvers/newton.hpp"));
+    EXPECT_TRUE(globMatch("newton.?pp", "newton.hpp"));
+    EXPECT_TRUE(globMatch("*a*b*c", "xxaxxbxxbc"));
+    EXPECT_FALSE(globMatch("*/solvers/*", "src/assembly/newton.hpp"));
+    EXPECT_FALSE(globMatch("newton", "newton.hpp"));
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+
+// Levels outlive finalize() (and initialize() only applies its level once),
+// so the ones the tests set are reset
+class ChannelLoggerTest : public LoggerTestWith<pressiolog::LogLevel::info> {
+protected:
+    void TearDown() override {
+        for (const char* channel : {"solvers", "solvers.newton", "linalg"}) {
+            PRESSIOLOG_RESET_CHANNEL_LEVEL(channel);
+        }
+        PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::info);
+        LoggerTestWith::TearDown();
+    }
+};
+
+void logAll(int i) {
+    PRESSIOLOG_DEBUG_CH("solvers.newton", "newton debug {}", i);
+    PRESSIOLOG_DEBUG_CH("solvers.gmres", "gmres debug {}", i);
+    PRESSIOLOG_DEBUG_CH("linalg", "linalg debug {}", i);
+    PRESSIOLOG_INFO_CH("linalg", "linalg info {}", i);
+    PRESSIOLOG_DEBUG("global debug {}", i);
+}
+
+TEST_F(ChannelLoggerTest, Serial_Channels_Default) {
+    CoutRedirector redirect;
+    logAll(0);
+
+    // Channels without a level follow the logging level
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "newton debug", false));
+    EXPECT_TRUE(check_output(output, "gmres debug",  false));
+    EXPECT_TRUE(check_output(output, "linalg debug", false));
+    EXPECT_TRUE(check_output(output, "linalg info 0", true));
+    EXPECT_TRUE(check_output(output, "global debug", false));
+}
+
+TEST_F(ChannelLoggerTest, Serial_Channels_Inherit) {
+    CoutRedirector redirect;
+    logAll(0);
+
+    // Children inherit from their closest parent with a level
+    PRESSIOLOG_SET_CHANNEL_LEVEL("solvers", pressiolog::LogLevel::debug);
+    logAll(1);
+    EXPECT_EQ(pressiolog::Logger::instance().channelLevel("solvers.newton.linesearch"),
+              pressiolog::LogLevel::debug);
+
+    // ... unless they have their own
+    PRESSIOLOG_SET_CHANNEL_LEVEL("solvers.newton", pressiolog::LogLevel::info);
+    logAll(2);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "newton debug 1", true));
+    EXPECT_TRUE(check_output(output, "gmres debug 1",  true));
+    EXPECT_TRUE(check_output(output, "newton debug 2", false));
+    EXPECT_TRUE(check_output(output, "gmres debug 2",  true));
+    EXPECT_TRUE(check_output(output, "linalg debug",   false));
+    EXPECT_TRUE(check_output(output, "global debug",   false));
+}
+
+TEST_F(ChannelLoggerTest, Serial_Channels_Quieter) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_CHANNEL_LEVEL("linalg", pressiolog::LogLevel::none);
+    CoutRedirector redirect;
+    logAll(0);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "newton debug 0", true));
+    EXPECT_TRUE(check_output(output, "global debug 0", true));
+    EXPECT_TRUE(check_output(output, "linalg",         false));
+}
+
+TEST_F(ChannelLoggerTest, Serial_Channels_Reset) {
+    PRESSIOLOG_SET_CHANNEL_LEVEL("solvers", pressiolog::LogLevel::debug);
+    CoutRedirector redirect;
+    logAll(0);
+
+    PRESSIOLOG_RESET_CHANNEL_LEVEL("solvers");
+    EXPECT_EQ(pressiolog::Logger::instance().channelLevel("solvers.newton"),
+              pressiolog::LogLevel::info);
+    logAll(1);
+
+    // Changing the logging level applies to channels that inherit it
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    logAll(2);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "newton debug 0", true));
+    EXPECT_TRUE(check_output(output, "newton debug 1", false));
+    EXPECT_TRUE(check_output(output, "newton debug 2", true));
+    EXPECT_TRUE(check_output(output, "linalg debug 2", true));
+}
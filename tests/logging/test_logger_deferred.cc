@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/logger/binarylog.hpp"
+
+using DeferredLoggerTest = LoggerTestWith<pressiolog::LogLevel::debug, pressiolog::LogMode::deferred>;
+
+struct Streamable {
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& s) {
+    return os << "Streamable(" << s.value << ")";
+}
+
+struct Formattable {
+    int value;
+};
+
+template <>
+struct fmt::formatter<Formattable> : fmt::formatter<int> {
+    auto format(const Formattable& f, fmt::format_context& ctx) const {
+        return fmt::formatter<int>::format(f.value * 2, ctx);
+    }
+};
+
+TEST_F(DeferredLoggerTest, Serial_Deferred_Types) {
+    CoutRedirector redirect;
+
+    int i = -7;
+    unsigned u = 7;
+    long long ll = 1234567890123LL;
+    std::string_view view = "view";
+    const char* c_str = "c_str";
+    PRESSIOLOG_INFO("ints: {} {} {}", i, u, ll);
+    PRESSIOLOG_INFO("floats: {:.3f} {:e}", 3.14159, 2.5f);
+    PRESSIOLOG_INFO("misc: {} {} {:>6}", true, 'x', 42);
+    PRESSIOLOG_INFO("strings: {} {} {}", c_str, std::string("temporary"), view);
+    PRESSIOLOG_INFO("pointer: {}", static_cast<const void*>(c_str));
+    PRESSIOLOG_FLUSH();
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "ints: -7 7 1234567890123", true));
+    EXPECT_TRUE(check_output(output, "floats: 3.142 2.500000e+00", true));
+    EXPECT_TRUE(check_output(output, "misc: true x     42", true));
+    EXPECT_TRUE(check_output(output, "strings: c_str temporary view", true));
+    EXPECT_TRUE(check_output(
+        output, fmt::format("pointer: {}", static_cast<const void*>(c_str)), true));
+}
+
+TEST_F(DeferredLoggerTest, Serial_Deferred_EagerFallback) {
+    CoutRedirector redirect;
+
+    // Types that cannot be copied as raw bytes are formatted on the caller
+    PRESSIOLOG_INFO("custom: {} {}", Streamable{3}, Formattable{4});
+    PRESSIOLOG_FLUSH();
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "custom: Streamable(3) 8", true));
+}
+
+TEST_F(DeferredLoggerTest, Serial_Deferred_Order) {
+    CoutRedirector redirect;
+
+    PRESSIOLOG_INFO("first {}", 1);
+    PRESSIOLOG_INFO("second {}", Streamable{2});
+    PRESSIOLOG_INFO("third");
+    PRESSIOLOG_FINALIZE();
+
+    std::string output = redirect.str();
+    auto first = output.find("first 1");
+    auto second = output.find("second Streamable(2)");
+    auto third = output.find("third");
+    ASSERT_NE(first, std::string::npos);
+    ASSERT_NE(second, std::string::npos);
+    ASSERT_NE(third, std::string::npos);
+    EXPECT_LT(first, second);
+    EXPECT_LT(second, third);
+}
+
+TEST_F(DeferredLoggerTest, Serial_Deferred_RuntimeString) {
+    CoutRedirector redirect;
+
+    std::string fmt_str = "runtime {} {}";
+    PRESSIOLOG_INFO(fmt::runtime(fmt_str), 1, "two");
+    // The format string is copied, so it may change once the call returns
+    fmt_str = "changed";
+    PRESSIOLOG_FLUSH();
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "runtime 1 two", true));
+}
+
+TEST_F(DeferredLoggerTest, Serial_Deferred_Binary) {
+    const std::string textName = "deferred_text.log";
+    const std::string binaryName = "deferred_binary.log";
+    auto run = [](const std::string& fileName, pressiolog::FileFormat format) {
+        std::filesystem::remove(fileName);
+        PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+        PRESSIOLOG_SET_FILE_FORMAT(format);
+        PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+        for (int i = 0; i < 100; ++i) {
+            PRESSIOLOG_INFO("Step {} value {:.3f} {}", i, i * 0.5, Streamable{i});
+            PRESSIOLOG_WARNING("Step {} of {}", i, "steps");
+        }
+        PRESSIOLOG_FLUSH();
+    };
+    run(textName, pressiolog::FileFormat::text);
+    run(binaryName, pressiolog::FileFormat::binary);
+    PRESSIOLOG_SET_FILE_FORMAT(pressiolog::FileFormat::text);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::console);
+
+    std::ifstream file(binaryName, std::ios::binary);
+    const std::string data(std::istreambuf_iterator<char>(file), {});
+    std::ostringstream decoded;
+    pressiolog::binlog::decode(data, decoded);
+    EXPECT_EQ(decoded.str(), read_file(textName));
+
+    std::filesystem::remove(textName);
+    std::filesystem::remove(binaryName);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "helpers.hpp"
+#include "pressio-log/core.hpp"
+
+using pressiolog::LogLevel;
+
+TEST(EnvironmentTest, Serial_Environment_Initialize) {
+    // Set before the (only) initialization in this test program
+    setenv("PRESSIOLOG_LEVEL", "Debug", 1);
+    setenv("PRESSIOLOG_DEST", "both", 1);
+    setenv("PRESSIOLOG_FILE", "environment_test.log", 1);
+    setenv("PRESSIOLOG_CHANNELS", "solvers=warning, linalg.dense = 2", 1);
+    setenv("PRESSIOLOG_ASYNC", "", 1);  // empty variables are ignored
+    std::filesystem::remove("environment_test.log");
+
+    {
+        CoutRedirector redirect;
+        PRESSIOLOG_INITIALIZE(LogLevel::sparse, pressiolog::LogTo::console, "pressio.log");
+        PRESSIOLOG_DEBUG("debug from the environment");
+        PRESSIOLOG_INFO_CH("solvers.newton", "newton info");
+        PRESSIOLOG_WARNING_CH("solvers.newton", "newton warning");
+        EXPECT_EQ(pressiolog::Logger::instance().channelLevel("linalg.dense.lu"), LogLevel::error);
+        PRESSIOLOG_FINALIZE();
+
+        std::string output = redirect.str();
+        EXPECT_TRUE(check_output(output, "debug from the environment", true));
+        EXPECT_TRUE(check_output(output, "newton info",    false));
+        EXPECT_TRUE(check_output(output, "newton warning", true));
+    }
+
+    std::string file_output = read_file("environment_test.log");
+    EXPECT_TRUE(check_output(file_output, "debug from the environment", true));
+    std::filesystem::remove("environment_test.log");
+
+    for (const char* variable : {"PRESSIOLOG_LEVEL", "PRESSIOLOG_DEST", "PRESSIOLOG_FILE",
+                                 "PRESSIOLOG_CHANNELS", "PRESSIOLOG_ASYNC"}) {
+        unsetenv(variable);
+    }
+}
+
+TEST(EnvironmentTest, Serial_Environment_Parse) {
+    using namespace pressiolog::env;
+    EXPECT_EQ(parseLevel("none"), LogLevel::none);
+    EXPECT_EQ(parseLevel(" INFO "), LogLevel::info);
+    EXPECT_EQ(parseLevel("5"), LogLevel::debug);
+    EXPECT_EQ(parseDestination("File"), pressiolog::LogTo::file);
+    EXPECT_EQ(parseMode("1"), pressiolog::LogMode::async);
+    EXPECT_EQ(parseMode("off"), pressiolog::LogMode::sync);
+    EXPECT_EQ(parseMode("deferred"), pressiolog::LogMode::deferred);
+    EXPECT_EQ(parseRank("3"), 3);
+
+    const auto channels = parseChannels("a=debug,,a.b=none");
+    ASSERT_EQ(channels.size(), 2);
+    EXPECT_EQ(channels[0].first, "a");
+    EXPECT_EQ(channels[0].second, LogLevel::debug);
+    EXPECT_EQ(channels[1].first, "a.b");
+    EXPECT_EQ(channels[1].second, LogLevel::none);
+}
+
+TEST(EnvironmentTest, Serial_Environment_Invalid) {
+    using namespace pressiolog::env;
+    EXPECT_THROW(parseLevel("verbose"), std::runtime_error);
+    EXPECT_THROW(parseDestination("stdout"), std::runtime_error);
+    EXPECT_THROW(parseMode("maybe"), std::runtime_error);
+    EXPECT_THROW(parseRank("-1"), std::runtime_error);
+    EXPECT_THROW(parseRank("2x"), std::runtime_error);
+    EXPECT_THROW(parseChannels("solvers"), std::runtime_error);
+    EXPECT_THROW(parseChannels("solvers=loud"), std::runtime_error);
+}
@@ -1,9 +1,55 @@
 #include <gtest/gtest.h>
+#include <iomanip>
+#include <ostream>
 
 #include "helpers.hpp"
 #include "LoggerTest.hpp"
 #include "pressio-log/core.hpp"
 
+// Only printable with operator<<
+struct Point {
+    double x, y;
+};
+
+std::ostream& operator<<(std::ostream& os, const Point& p) {
+    return os << std::fixed << std::setprecision(1) << "(" << p.x << ", " << p.y << ")";
+}
+
+// Longer than the stream's put area
+struct Blob {
+    std::string text;
+};
+
+std::ostream& operator<<(std::ostream& os, const Blob& b) {
+    for (char c : b.text) {
+        os << c;
+    }
+    return os;
+}
+
+// An operator<< that logs
+struct Noisy {
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Noisy& n) {
+    PRESSIOLOG_SPARSE("Printing {}", Point{1.0, 2.0});
+    return os << "Noisy(" << n.value << ")";
+}
+
+// An operator<< that logs a value of its own type, which must then be
+// written without the thread's stream
+struct Recursive {
+    int depth;
+};
+
+std::ostream& operator<<(std::ostream& os, const Recursive& r) {
+    if (r.depth > 0) {
+        PRESSIOLOG_SPARSE("Inner {}", Recursive{r.depth - 1});
+    }
+    return os << "Recursive(" << r.depth << ")";
+}
+
 void runTest() {
     PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
 
@@ -33,3 +79,89 @@ void runTest() {
 TEST_F(LoggerTest, Serial_Formatting) {
     runTest();
 }
+
+TEST_F(LoggerTest, Serial_Formatting_Arguments) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    CoutRedirector redirect;
+
+    const std::string name = "newton";
+    PRESSIOLOG_SPARSE("Solver: {}, level: {}", name, pressiolog::LogLevel::info);
+
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "Solver: newton, level: info", true))
+        << "\nOutput:\n" << output;
+}
+
+TEST_F(LoggerTest, Serial_Formatting_RuntimeString) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    CoutRedirector redirect;
+
+    const std::string fmt_str = "Runtime: {:>4}";
+    PRESSIOLOG_SPARSE(fmt::runtime(fmt_str), 7);
+
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "Runtime:    7", true))
+        << "\nOutput:\n" << output;
+
+    // Errors in runtime format strings are reported when logging
+    const std::string bad_fmt_str = "Runtime: {:d}";
+    EXPECT_THROW(PRESSIOLOG_SPARSE(fmt::runtime(bad_fmt_str), "not an int"), std::runtime_error);
+}
+
+TEST_F(LoggerTest, Serial_Formatting_Colors) {
+    using pressiolog::LogLevel;
+    namespace colors = pressiolog::colors;
+    static_assert(colors::prefix(LogLevel::warning, false) == "WARNING: ");
+    static_assert(colors::prefix(LogLevel::error, true) == "\033[31mERROR: ");
+    static_assert(colors::prefix(LogLevel::info, true).empty());
+    static_assert(colors::suffix(LogLevel::warning, true) == colors::reset);
+    static_assert(colors::suffix(LogLevel::warning, false).empty());
+
+    // The tests' stdout is not a terminal, so nothing is colored
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::warning);
+    CoutRedirector redirect;
+    PRESSIOLOG_WARNING("Plain {}", 1);
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "[0] WARNING: Plain 1", true)) << "\nOutput:\n" << output;
+    EXPECT_EQ(output.find('\033'), std::string::npos) << "\nOutput:\n" << output;
+}
+
+TEST_F(LoggerTest, Serial_Formatting_Enums) {
+    EXPECT_EQ(fmt::format("{}", pressiolog::LogLevel::warning), "warning");
+    EXPECT_EQ(fmt::format("[{:>7}]", pressiolog::LogLevel::info), "[   info]");
+    EXPECT_EQ(fmt::format("{} {} {} {} {} {}", pressiolog::LogTo::both, pressiolog::LogMode::deferred,
+                          pressiolog::FileFormat::binary, pressiolog::TimestampMode::since_start,
+                          pressiolog::OnOverflow::drop_oldest, pressiolog::CallsiteState::disabled),
+              "both deferred binary since_start drop_oldest disabled");
+    static_assert(fmt::is_formattable<pressiolog::LogLevel>::value);
+}
+
+TEST_F(LoggerTest, Serial_Formatting_Streamed) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    CoutRedirector redirect;
+
+    // Each argument starts from a default stream state
+    const Point p{0.5, 2.0};
+    PRESSIOLOG_SPARSE("Point {} then {}", p, Point{3.0, 4.0});
+    PRESSIOLOG_SPARSE("Padded [{:>12}] [{:<12}]", p, Point{1.0, 1.0});
+    PRESSIOLOG_SPARSE("Nested {}", Noisy{7});
+    PRESSIOLOG_SPARSE("Outer {}", Recursive{1});
+    PRESSIOLOG_SPARSE("Blob {}.", Blob{std::string(1000, 'x')});
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "Point (0.5, 2.0) then (3.0, 4.0)", true))
+        << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Padded [  (0.5, 2.0)] [(1.0, 1.0)  ]", true))
+        << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Printing (1.0, 2.0)", true)) << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Nested Noisy(7)", true)) << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Inner Recursive(0)", true)) << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Outer Recursive(1)", true)) << "\nOutput:\n" << output;
+    EXPECT_TRUE(check_output(output, "Blob " + std::string(1000, 'x') + ".", true));
+}
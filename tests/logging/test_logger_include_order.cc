@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "macros_template.hpp"
+
+// Defined in include_order.cc, which includes macros_template.hpp before core.hpp
+void logBeforeCore(int i);
+
+TEST_F(LoggerTest, Serial_IncludeOrder_SameOutput) {
+    CoutRedirector redirect;
+    logBeforeCore(1);
+    logValue("after level", pressiolog::LogLevel::info);
+    logValue("after count", 1);
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "before level = info", true));
+    EXPECT_TRUE(check_output(output, "before count = 1", true));
+    EXPECT_TRUE(check_output(output, "after level = info", true));
+    EXPECT_TRUE(check_output(output, "after count = 1", true));
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+
+// Defined in macros_only.cc, which only includes pressio-log/macros.hpp
+void lightLogAll(int i);
+void lightLogOnce(int i);
+
+TEST_F(LoggerTest, Serial_Macros_Formatting) {
+    CoutRedirector redirect;
+    lightLogAll(1);
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "light sparse 1 2.50 solver view", true));
+    EXPECT_TRUE(check_output(output, "light message {} kept as is", true));
+    // The default level is sparse
+    EXPECT_TRUE(check_output(output, "light info", false));
+    EXPECT_TRUE(check_output(output, "light debug", false));
+}
+
+TEST_F(LoggerTest, Serial_Macros_Levels) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::info);
+    PRESSIOLOG_SET_CHANNEL_LEVEL("light", pressiolog::LogLevel::warning);
+    CoutRedirector redirect;
+    lightLogAll(2);
+    PRESSIOLOG_RESET_CHANNEL_LEVEL("light");
+    lightLogAll(3);
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "light info 2", true));
+    EXPECT_TRUE(check_output(output, "light debug 2", false));
+    EXPECT_TRUE(check_output(output, "light channel 2", false));
+    EXPECT_TRUE(check_output(output, "light channel 3", true));
+}
+
+TEST_F(LoggerTest, Serial_Macros_Callsites) {
+    CoutRedirector redirect;
+    PRESSIOLOG_DISABLE_CALLSITES("*macros_only.cc");
+    lightLogAll(4);
+    PRESSIOLOG_RESET_CALLSITES();
+    lightLogOnce(5);
+    lightLogOnce(6);
+
+    std::string output = redirect.str();
+    EXPECT_TRUE(check_output(output, "light sparse 4", false));
+    EXPECT_TRUE(check_output(output, "light once 5", true));
+    EXPECT_TRUE(check_output(output, "light once 6", false));
+}
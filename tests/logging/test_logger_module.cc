@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+
+// Uses the logger only through the pressio.log module (pressio-log::module)
+import pressio.log;
+#include <pressio-log/module.hpp>
+
+struct Point { int x; int y; };
+
+template <>
+struct fmt::formatter<Point> : fmt::formatter<int> {
+    auto format(const Point& p, fmt::format_context& ctx) const {
+        return fmt::format_to(ctx.out(), "({}, {})", p.x, p.y);
+    }
+};
+
+TEST(ModuleTest, Serial_Module_Logging) {
+    PRESSIOLOG_INITIALIZE(pressiolog::LogLevel::info, pressiolog::LogTo::console);
+    CoutRedirector redirect;
+    std::vector<int> values{1, 2, 3};
+    PRESSIOLOG_INFO("packed {} {}", 1, std::string("two"));
+    PRESSIOLOG_INFO("level {}", pressiolog::LogLevel::debug);
+    PRESSIOLOG_INFO("point {}", Point{1, 2});
+    PRESSIOLOG_INFO("values {}", pressiolog::range(values));
+    PRESSIOLOG_DEBUG("hidden {}", 3);
+    PRESSIOLOG_FLUSH();
+    std::string output = redirect.str();
+    PRESSIOLOG_FINALIZE();
+    EXPECT_TRUE(check_output(output, "packed 1 two", true));
+    EXPECT_TRUE(check_output(output, "level debug", true));
+    EXPECT_TRUE(check_output(output, "point (1, 2)", true));
+    EXPECT_TRUE(check_output(output, "values [1, 2, 3]", true));
+    EXPECT_TRUE(check_output(output, "hidden", false));
+}
@@ -46,6 +46,27 @@ void runTest(LogLevel level) {
     MPI_Barrier(MPI_COMM_WORLD);
 }
 
+TEST_F(LoggerTest, Parallel_FilteredArgumentsNotEvaluated) {
+    PRESSIOLOG_SET_LEVEL(LogLevel::info);
+    PRESSIOLOG_SET_LOGGING_RANK(1);
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    CoutRedirector redirect;
+
+    int evaluations = 0;
+    PRESSIOLOG_INFO("Info {}", count_evaluations(evaluations));
+
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "[1] Info 1", rank == 1));
+    EXPECT_EQ(evaluations, rank == 1 ? 1 : 0);
+
+    PRESSIOLOG_SET_LOGGING_RANK(0);
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
 TEST_F(LoggerTest, Parallel_LogLevel_None) {
     runTest(LogLevel::none);
 }
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/core.hpp"
+
+std::vector<double> iota(std::size_t size) {
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<double>(i + 1);
+    }
+    return values;
+}
+
+TEST_F(LoggerTest, Serial_Ranges_Elided) {
+    const auto x = iota(2048);
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x)),
+              "[1, 2, 3, 4, 5, ... 2038 more ..., 2044, 2045, 2046, 2047, 2048]");
+
+    pressiolog::RangeOptions options;
+    options.max_elements = 3;
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x, options)), "[1, 2, ... 2045 more ..., 2048]");
+    options.max_elements = 0;
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x, options)), "[... 2048 more ...]");
+
+    // Short ranges are shown whole
+    const std::array<int, 3> a{3, -1, 2};
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(a)), "[3, -1, 2]");
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x.data(), 0)), "[]");
+}
+
+TEST_F(LoggerTest, Serial_Ranges_Precision) {
+    const std::vector<double> x{0.5, 1.0 / 3.0, 1234.5678};
+    EXPECT_EQ(fmt::format("{:.2e}", pressiolog::range(x)), "[5.00e-01, 3.33e-01, 1.23e+03]");
+    EXPECT_EQ(fmt::format("{:>6.1f}", pressiolog::range(x)), "[   0.5,    0.3, 1234.6]");
+
+    pressiolog::RangeOptions options;
+    options.precision = 3;
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x, options)), "[0.5, 0.333, 1.23e+03]");
+    // The format specification takes precedence
+    EXPECT_EQ(fmt::format("{:.1f}", pressiolog::range(x, options)), "[0.5, 0.3, 1234.6]");
+}
+
+TEST_F(LoggerTest, Serial_Ranges_Stats) {
+    // The statistics cover every element, including the elided ones
+    const std::vector<int> x{3, -4, 100, 0, 0, 0};
+    pressiolog::RangeOptions options;
+    options.max_elements = 2;
+    options.stats = true;
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x, options)),
+              "[3, ... 4 more ..., 0] (n=6, min=-4, max=100, norm=100.12492197250393)");
+    options.precision = 3;
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x, options)),
+              "[3, ... 4 more ..., 0] (n=6, min=-4, max=100, norm=100)");
+    EXPECT_EQ(fmt::format("{}", pressiolog::range(x.data(), 0, options)), "[] (n=0)");
+}
+
+TEST_F(LoggerTest, Serial_Ranges_Matrix) {
+    const auto values = iota(12);
+    EXPECT_EQ(fmt::format("{}", pressiolog::matrix(values.data(), 3, 4)),
+              "[[1, 2, 3, 4], [5, 6, 7, 8], [9, 10, 11, 12]]");
+    EXPECT_EQ(fmt::format("{}", pressiolog::matrix(values.data(), 3, 4,
+                                                   pressiolog::MatrixLayout::col_major)),
+              "[[1, 4, 7, 10], [2, 5, 8, 11], [3, 6, 9, 12]]");
+
+    const auto large = iota(100 * 50);
+    pressiolog::RangeOptions options;
+    options.max_elements = 2;
+    options.precision = 6;
+    options.stats = true;
+    EXPECT_EQ(fmt::format("{}", pressiolog::matrix(large.data(), 100, 50,
+                                                   pressiolog::MatrixLayout::row_major, options)),
+              "[[1, ... 48 more ..., 50], ... 98 more rows ..., [4951, ... 48 more ..., 5000]]"
+              " (100x50, min=1, max=5000, norm=204155)");
+}
+
+TEST_F(LoggerTest, Serial_Ranges_Logged) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    CoutRedirector redirect;
+
+    const auto x = iota(1000);
+    PRESSIOLOG_SPARSE("State: {:.1f}", pressiolog::range(x));
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(
+        output, "State: [1.0, 2.0, 3.0, 4.0, 5.0, ... 990 more ..., 996.0, 997.0, 998.0, 999.0, 1000.0]",
+        true)) << "\nOutput:\n" << output;
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+
+using RateLimitedLoggerTest = LoggerTestWith<pressiolog::LogLevel::debug>;
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_EveryN) {
+    CoutRedirector redirect;
+
+    int evaluations = 0;
+    for (int i = 0; i < 10; ++i) {
+        PRESSIOLOG_DEBUG_EVERY_N(4, "every 4: iteration {} ({})", i, count_evaluations(evaluations));
+    }
+
+    std::string output = redirect.str();
+    EXPECT_EQ(count_lines(output, "every 4:"), 3);
+    EXPECT_TRUE(check_output(output, "every 4: iteration 0 (1)", true));
+    EXPECT_TRUE(check_output(output, "every 4: iteration 4 (2)", true));
+    EXPECT_TRUE(check_output(output, "every 4: iteration 8 (3)", true));
+
+    // Arguments are only evaluated for emitted messages
+    EXPECT_EQ(evaluations, 3);
+}
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_OnceAndFirstN) {
+    CoutRedirector redirect;
+
+    for (int i = 0; i < 10; ++i) {
+        PRESSIOLOG_INFO_ONCE("once: iteration {}", i);
+        PRESSIOLOG_WARNING_FIRST_N(3, "first 3: iteration {}", i);
+    }
+
+    std::string output = redirect.str();
+    EXPECT_EQ(count_lines(output, "once:"), 1);
+    EXPECT_TRUE(check_output(output, "once: iteration 0", true));
+    EXPECT_EQ(count_lines(output, "first 3:"), 3);
+    EXPECT_TRUE(check_output(output, "first 3: iteration 2", true));
+    EXPECT_TRUE(check_output(output, "first 3: iteration 3", false));
+}
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_Callsites) {
+    CoutRedirector redirect;
+
+    // Each callsite keeps its own state, even when called through a function
+    auto log_once = [](int i) { PRESSIOLOG_INFO_ONCE("lambda once: {}", i); };
+    for (int i = 0; i < 3; ++i) {
+        PRESSIOLOG_INFO_ONCE("loop once: {}", i);
+        log_once(i);
+    }
+
+    std::string output = redirect.str();
+    EXPECT_EQ(count_lines(output, "loop once:"), 1);
+    EXPECT_EQ(count_lines(output, "lambda once:"), 1);
+}
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_DisabledLevel) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::info);
+    CoutRedirector redirect;
+
+    // Occurrences at a disabled level are not counted
+    auto log_debug = [](int i) { PRESSIOLOG_DEBUG_ONCE("debug once: {}", i); };
+    log_debug(0);
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    log_debug(1);
+    log_debug(2);
+
+    std::string output = redirect.str();
+    EXPECT_EQ(count_lines(output, "debug once:"), 1);
+    EXPECT_TRUE(check_output(output, "debug once: 1", true));
+}
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_EveryMs) {
+    CoutRedirector redirect;
+
+    const auto start = std::chrono::steady_clock::now();
+    int iterations = 0;
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(250)) {
+        PRESSIOLOG_INFO_EVERY_MS(100, "every 100 ms: {}", iterations);
+        ++iterations;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // At most one message per interval (plus the first one)
+    std::string output = redirect.str();
+    const auto lines = count_lines(output, "every 100 ms:");
+    EXPECT_GE(lines, 1);
+    EXPECT_LE(lines, 3);
+    EXPECT_TRUE(check_output(output, "every 100 ms: 0", true));
+    EXPECT_LT(lines, static_cast<std::size_t>(iterations));
+}
+
+TEST_F(RateLimitedLoggerTest, Serial_RateLimited_Threads) {
+    CoutRedirector redirect;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 100; ++i) {
+                PRESSIOLOG_DEBUG_EVERY_N(10, "shared every 10");
+                PRESSIOLOG_DEBUG_FIRST_N(5, "shared first 5");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::string output = redirect.str();
+    EXPECT_EQ(count_lines(output, "shared every 10"), 40);
+    EXPECT_EQ(count_lines(output, "shared first 5"), 5);
+}
@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "helpers.hpp"
 #include "LoggerTest.hpp"
 #include "pressio-log/core.hpp"
+#include "pressio-log/logger/consolesink.hpp"
 
 void runTest(pressiolog::LogLevel level) {
     PRESSIOLOG_SET_LEVEL(level);
@@ -39,3 +43,92 @@ TEST_F(LoggerTest, Serial_LogLevel_Info) {
 TEST_F(LoggerTest, Serial_LogLevel_Debug) {
     runTest(pressiolog::LogLevel::debug);
 }
+
+TEST_F(LoggerTest, Serial_FilteredArgumentsNotEvaluated) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+
+    CoutRedirector redirect;
+
+    int evaluations = 0;
+    PRESSIOLOG_SPARSE("Sparse {}", count_evaluations(evaluations));
+    PRESSIOLOG_INFO("Info {}", count_evaluations(evaluations));
+    PRESSIOLOG_DEBUG("Debug {}", count_evaluations(evaluations));
+
+    std::string output = redirect.str();
+
+    EXPECT_TRUE(check_output(output, "Sparse 1", true));
+    EXPECT_TRUE(check_output(output, "Info",     false));
+    EXPECT_TRUE(check_output(output, "Debug",    false));
+    EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(LoggerTest, Serial_SharedAccessorMatchesInstance) {
+    auto shared = pressiolog::Logger::PressioLogger();
+    EXPECT_EQ(shared.get(), &pressiolog::Logger::instance());
+    EXPECT_EQ(pressiolog::Logger::PressioLogger().get(), shared.get());
+}
+
+TEST_F(LoggerTest, Serial_ConsoleFlushPolicy) {
+    // Line-buffered on a terminal, only flushed on errors otherwise
+    auto policy = pressiolog::ConsoleSink::defaultFlushPolicy();
+    bool is_terminal = pressiolog::ConsoleSink::stdoutIsTerminal();
+    EXPECT_EQ(policy.every_message, is_terminal);
+    EXPECT_EQ(policy.on_warning, is_terminal);
+    EXPECT_TRUE(policy.on_error);
+
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::info);
+    PRESSIOLOG_SET_CONSOLE_FLUSH_POLICY(pressiolog::FlushPolicy::buffered());
+
+    CoutRedirector redirect;
+    PRESSIOLOG_INFO("Buffered console");
+    PRESSIOLOG_FLUSH();
+    EXPECT_TRUE(check_output(redirect.str(), "Buffered console", true));
+
+    PRESSIOLOG_SET_CONSOLE_FLUSH_POLICY(policy);
+}
+
+TEST_F(LoggerTest, Serial_ConfigSnapshot) {
+    using pressiolog::ConfigSnapshot;
+    using pressiolog::LogLevel;
+    using pressiolog::LogTo;
+    auto config = ConfigSnapshot().withLoggingRank(true).withLevel(LogLevel::info);
+    EXPECT_TRUE(config.enabled(LogLevel::warning));
+    EXPECT_FALSE(config.enabled(LogLevel::debug));
+    EXPECT_FALSE(config.enabled(LogLevel::none));
+    EXPECT_FALSE(config.withLoggingRank(false).enabled(LogLevel::sparse));
+
+    auto both = config.withDestination(LogTo::both);
+    EXPECT_TRUE(both.toConsole() and both.toFile());
+    auto file = both.withDestination(LogTo::file);
+    EXPECT_FALSE(file.toConsole());
+    EXPECT_TRUE(file.toFile());
+    EXPECT_EQ(file.level(), LogLevel::info);
+}
+
+TEST_F(LoggerTest, Serial_ReconfigureWhileLogging) {
+    // Setters may run concurrently with logging threads
+    CoutRedirector redirect;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&done, t]() {
+            for (int i = 0; !done.load(); ++i) {
+                PRESSIOLOG_INFO("Thread {} message {}", t, i);
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i) {
+        PRESSIOLOG_SET_LEVEL(i % 2 ? pressiolog::LogLevel::info : pressiolog::LogLevel::sparse);
+    }
+    done.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::sparse);
+    PRESSIOLOG_INFO("Filtered");
+    PRESSIOLOG_SPARSE("Kept");
+    auto output = redirect.str();
+    EXPECT_TRUE(check_output(output, "Filtered", false));
+    EXPECT_TRUE(check_output(output, "Kept", true));
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <ctime>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helpers.hpp"
+#include "LoggerTest.hpp"
+#include "pressio-log/core.hpp"
+#include "pressio-log/logger/tickclock.hpp"
+
+using pressiolog::TimestampMode;
+
+std::vector<std::string> linesWith(const std::string& output, const std::string& str) {
+    std::vector<std::string> lines;
+    std::istringstream stream(output);
+    for (std::string line; std::getline(stream, line);) {
+        if (line.find(str) != std::string::npos) {
+            lines.push_back(line);
+        }
+    }
+    return lines;
+}
+
+// Logs two messages 20 ms apart with the given timestamps
+std::vector<std::string> logTwo(TimestampMode mode) {
+    PRESSIOLOG_SET_TIMESTAMP_MODE(mode);
+    CoutRedirector redirect;
+    PRESSIOLOG_SPARSE("First stamped");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    PRESSIOLOG_SPARSE("Second stamped");
+    PRESSIOLOG_SET_TIMESTAMP_MODE(TimestampMode::none);
+    return linesWith(redirect.str(), "stamped");
+}
+
+TEST_F(LoggerTest, Serial_Timestamps_None) {
+    CoutRedirector redirect;
+    PRESSIOLOG_SPARSE("Plain");
+    EXPECT_EQ(redirect.str(), "[0] Plain\n");
+}
+
+TEST_F(LoggerTest, Serial_Timestamps_Absolute) {
+    const auto lines = logTwo(TimestampMode::absolute);
+    ASSERT_EQ(lines.size(), 2);
+
+    std::smatch match;
+    const std::regex pattern(R"(^(\d{4})-(\d\d)-(\d\d) (\d\d):(\d\d):(\d\d)\.\d{6} \[0\] First stamped$)");
+    ASSERT_TRUE(std::regex_match(lines[0], match, pattern)) << lines[0];
+
+    // Local time, within a few seconds of now
+    std::tm local{};
+    local.tm_year = std::stoi(match[1]) - 1900;
+    local.tm_mon  = std::stoi(match[2]) - 1;
+    local.tm_mday = std::stoi(match[3]);
+    local.tm_hour = std::stoi(match[4]);
+    local.tm_min  = std::stoi(match[5]);
+    local.tm_sec  = std::stoi(match[6]);
+    local.tm_isdst = -1;
+    EXPECT_LT(std::abs(std::difftime(std::time(nullptr), std::mktime(&local))), 5.0);
+}
+
+TEST_F(LoggerTest, Serial_Timestamps_SinceStart) {
+    const auto lines = logTwo(TimestampMode::since_start);
+    ASSERT_EQ(lines.size(), 2);
+    const std::regex pattern(R"(^ *(\d+\.\d{6}) \[0\] \w+ stamped$)");
+    std::smatch first, second;
+    ASSERT_TRUE(std::regex_match(lines[0], first, pattern)) << lines[0];
+    ASSERT_TRUE(std::regex_match(lines[1], second, pattern)) << lines[1];
+    const double elapsed = std::stod(second[1]) - std::stod(first[1]);
+    EXPECT_GE(elapsed, 0.019);
+    EXPECT_LT(elapsed, 1.0);
+}
+
+TEST_F(LoggerTest, Serial_Timestamps_Delta) {
+    const auto lines = logTwo(TimestampMode::delta);
+    ASSERT_EQ(lines.size(), 2);
+    const std::regex pattern(R"(^[+-](\d+\.\d{6}) \[0\] Second stamped$)");
+    std::smatch match;
+    ASSERT_TRUE(std::regex_match(lines[1], match, pattern)) << lines[1];
+    EXPECT_GE(std::stod(match[1]), 0.019);
+    EXPECT_LT(std::stod(match[1]), 1.0);
+}
+
+TEST(TickClockTest, Serial_TickClock_Elapsed) {
+    pressiolog::TickClock clock;
+    clock.calibrate();
+    const auto start = std::chrono::steady_clock::now();
+    const auto ticks = pressiolog::TickClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const auto end_ticks = pressiolog::TickClock::now();
+    const auto expected = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    const auto measured = clock.sinceStart(end_ticks) - clock.sinceStart(ticks);
+    EXPECT_NEAR(static_cast<double>(measured), static_cast<double>(expected), 0.05 * expected);
+    EXPECT_NEAR(static_cast<double>(clock.nanoseconds(static_cast<std::int64_t>(end_ticks - ticks))),
+                static_cast<double>(expected), 0.05 * expected);
+}
+
+TEST(TimestampTextTest, Serial_TimestampText_MatchesLocaltime) {
+    // Walks across minute boundaries, then jumps back as out-of-order records would
+    pressiolog::TimestampText text;
+    const std::int64_t start = 1700000000;
+    const std::vector<std::int64_t> offsets{0, 1, 59, 60, 61, 119, 3600, 5, 86399, 86400};
+    for (std::int64_t offset : offsets) {
+        const std::int64_t seconds = start + offset;
+        const std::int64_t ns = seconds * 1000000000 + 123456789;
+        const std::time_t time = static_cast<std::time_t>(seconds);
+        std::tm local{};
+        localtime_r(&time, &local);
+        char expected[64];
+        std::strftime(expected, sizeof(expected), "%Y-%m-%d %H:%M:%S.123456 ", &local);
+        EXPECT_EQ(text.format(ns), expected) << offset;
+    }
+}
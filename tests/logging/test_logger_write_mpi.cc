@@ -36,6 +36,8 @@ void runTest(pressiolog::LogTo dst) {
     PRESSIOLOG_WARNING("foo");   // will be prefixed by "WARNING: "
     PRESSIOLOG_ERROR("bar");     // will be prefixed by "ERROR: "
 
+    // Files are block-buffered, so every rank flushes before rank 0 reads
+    PRESSIOLOG_FLUSH();
     MPI_Barrier(MPI_COMM_WORLD);
 
     if (dst == pressiolog::LogTo::console or
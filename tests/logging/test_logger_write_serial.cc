@@ -4,6 +4,8 @@
 #include "helpers.hpp"
 #include "LoggerTest.hpp"
 #include "pressio-log/core.hpp"
+#include "pressio-log/logger/consolesink.hpp"
+#include "pressio-log/logger/filesink.hpp"
 
 void runTest(pressiolog::LogTo dst) {
     PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
@@ -54,3 +56,108 @@ TEST_F(LoggerTest, Serial_LogTo_File) {
 TEST_F(LoggerTest, Serial_LogTo_Both) {
     runTest(pressiolog::LogTo::both);
 }
+
+TEST_F(LoggerTest, Serial_LogTo_File_Buffered) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+
+    const std::string fileName = "buffered_pressio.log";
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+    PRESSIOLOG_SET_FILE_FLUSH_POLICY(pressiolog::FlushPolicy::buffered(
+        1 << 20, std::chrono::milliseconds(0)));
+
+    PRESSIOLOG_INFO("Buffered");
+    EXPECT_TRUE(check_output(read_file(fileName), "Buffered", false));
+
+    // Warnings flush everything written so far
+    PRESSIOLOG_WARNING("Flushing");
+    auto output = read_file(fileName);
+    EXPECT_TRUE(check_output(output, "Buffered", true));
+    EXPECT_TRUE(check_output(output, "Flushing", true));
+
+    PRESSIOLOG_DEBUG("Explicit");
+    EXPECT_TRUE(check_output(read_file(fileName), "Explicit", false));
+    PRESSIOLOG_FLUSH();
+    EXPECT_TRUE(check_output(read_file(fileName), "Explicit", true));
+
+    PRESSIOLOG_SET_FILE_FLUSH_POLICY(pressiolog::FileSink::defaultFlushPolicy());
+    PRESSIOLOG_SET_OUTPUT_FILENAME("pressio.log");
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(LoggerTest, Serial_LogTo_File_DefaultFlushPolicy) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+
+    const std::string fileName = "default_pressio.log";
+    PRESSIOLOG_SET_OUTPUT_FILENAME(fileName);
+
+    // Files are not flushed after every message, or on warnings
+    const auto policy = pressiolog::FileSink::defaultFlushPolicy();
+    EXPECT_FALSE(policy.every_message);
+    EXPECT_FALSE(policy.on_warning);
+    EXPECT_GT(policy.every_bytes, 0u);
+    EXPECT_GT(policy.every.count(), 0);
+
+    PRESSIOLOG_INFO("Pending");
+    PRESSIOLOG_WARNING("Still pending");
+    EXPECT_TRUE(check_output(read_file(fileName), "Pending", false));
+
+    // Errors flush everything written so far
+    PRESSIOLOG_ERROR("Flushing");
+    auto output = read_file(fileName);
+    EXPECT_TRUE(check_output(output, "Pending", true));
+    EXPECT_TRUE(check_output(output, "Still pending", true));
+    EXPECT_TRUE(check_output(output, "Flushing", true));
+
+    PRESSIOLOG_SET_OUTPUT_FILENAME("pressio.log");
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(LoggerTest, Serial_LogTo_File_ChangeFilename) {
+    PRESSIOLOG_SET_LEVEL(pressiolog::LogLevel::debug);
+    PRESSIOLOG_SET_OUTPUT_STREAM(pressiolog::LogTo::file);
+
+    const std::string firstFileName = "first_pressio.log";
+    const std::string secondFileName = "second_pressio.log";
+
+    PRESSIOLOG_SET_OUTPUT_FILENAME(firstFileName);
+    PRESSIOLOG_INFO("First");
+    PRESSIOLOG_SET_OUTPUT_FILENAME(secondFileName);
+    PRESSIOLOG_INFO("Second");
+    // The first file was flushed when it was closed
+    PRESSIOLOG_FLUSH();
+
+    auto first = read_file(firstFileName);
+    auto second = read_file(secondFileName);
+    EXPECT_TRUE(check_output(first,  "First",  true));
+    EXPECT_TRUE(check_output(first,  "Second", false));
+    EXPECT_TRUE(check_output(second, "First",  false));
+    EXPECT_TRUE(check_output(second, "Second", true));
+
+    PRESSIOLOG_SET_OUTPUT_FILENAME("pressio.log");
+    std::filesystem::remove(firstFileName);
+    std::filesystem::remove(secondFileName);
+}
+
+TEST_F(LoggerTest, Serial_LogTo_Colors_PerSink) {
+    // The same line is colored on a colorizing console and plain in a file
+    const pressiolog::LogLine line{pressiolog::LogLevel::warning, "12:00 ", "[3] ", "Careful"};
+
+    CoutRedirector redirect;
+    pressiolog::ConsoleSink console;
+    console.setColorize(true);
+    console.write(line);
+    console.flush();
+    EXPECT_EQ(redirect.str(), "12:00 \033[32m[3] \033[0m\033[33mWARNING: Careful\033[0m\n");
+
+    const std::string fileName = "colors_per_sink.log";
+    std::filesystem::remove(fileName);
+    {
+        pressiolog::FileSink file;
+        file.setPath(fileName);
+        file.write(line);
+    }
+    EXPECT_EQ(read_file(fileName), "12:00 [3] WARNING: Careful\n");
+    std::filesystem::remove(fileName);
+}
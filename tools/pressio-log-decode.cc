@@ -0,0 +1,73 @@
+// pressio-log-decode: prints a binary pressio-log file (FileFormat::binary)
+// as the text the logger would have written.
+//
+// usage: pressio-log-decode [--timestamps] <binary log> [output file]
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <pressio-log/logger/binarylog.hpp>
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "usage: " << program << " [--timestamps] <binary log> [output file]\n"
+              << "  --timestamps  prefix each line with its time (seconds since the epoch)\n";
+}
+
+} // end anonymous namespace
+
+int main(int argc, char* argv[]) {
+    pressiolog::binlog::DecodeOptions options;
+    std::string input_name;
+    std::string output_name;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--timestamps" or arg == "-t") {
+            options.timestamps = true;
+        } else if (arg == "--help" or arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (input_name.empty()) {
+            input_name = arg;
+        } else if (output_name.empty()) {
+            output_name = arg;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (input_name.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::ifstream input(input_name, std::ios::binary);
+    if (!input) {
+        std::cerr << argv[0] << ": cannot open " << input_name << "\n";
+        return 1;
+    }
+    const std::string data(std::istreambuf_iterator<char>(input), {});
+
+    std::ofstream output_file;
+    if (!output_name.empty()) {
+        output_file.open(output_name);
+        if (!output_file) {
+            std::cerr << argv[0] << ": cannot open " << output_name << "\n";
+            return 1;
+        }
+    }
+    std::ostream& output = output_name.empty() ? std::cout : output_file;
+
+    try {
+        pressiolog::binlog::decode(data, output, options);
+    } catch (const std::runtime_error& e) {
+        output.flush();
+        std::cerr << argv[0] << ": " << input_name << ": " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}